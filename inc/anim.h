@@ -0,0 +1,13 @@
+// anim.h
+#ifndef ANIM_H
+#define ANIM_H
+
+// Structs AnimDef and Anim are defined in globals.h
+
+void initAnims(void);
+s16 startAnim(const AnimDef* def, Sprite** sprite, u16 owner); // -1 if every slot is busy
+void stopAnim(s16 a);
+void updateAnims(void);     // Once per frame: advances every running animation
+void refreshAnims(void);    // Re-apply current frames after sprites are recreated
+
+#endif // ANIM_H
@@ -6,6 +6,7 @@
 
 void initBackground(void); // For initial setup if needed, like clearing map data
 void generateRandomMapLayer(u16* mapData, u16 mapWidth, u16 mapHeight, u16 baseTileIndex, u16 numTilesInSet, u16 pal);
-void updateScrolling(void);
+void updateScrolling(void);   // Each simulation tick: scroll values follow the player
+void drawScrolling(void);     // Each rendered frame: stream the map and set the VDP scroll
 
 #endif // BACKGROUND_H
\ No newline at end of file
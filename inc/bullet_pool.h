@@ -0,0 +1,16 @@
+// bullet_pool.h
+#ifndef BULLET_POOL_H
+#define BULLET_POOL_H
+
+// Structs BulletPool and Bullet are defined in globals.h
+#include "globals.h"
+
+#define bulletPoolFree(pool) ((s16)(pool)->capacity - (s16)(pool)->live_count) // Slots that can still be allocated
+
+void initBulletPool(BulletPool* pool, Bullet* items, u16 size);
+s16 allocBullet(BulletPool* pool);          // O(1), -1 if the pool is at capacity
+void freeBullet(BulletPool* pool, s16 i);   // O(1), releases the sprite
+void clearBulletPool(BulletPool* pool);     // Free every live bullet
+void applyLevelPoolSizes(void);             // Set pool capacities (and mine cap) for game_level
+
+#endif // BULLET_POOL_H
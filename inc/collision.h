@@ -0,0 +1,37 @@
+// collision.h
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "hitbox.h"
+
+// Boxes are (x, y, w, h) in pixels and use the same open overlap test as the rest of the game:
+// a.x < b.x + b.w && a.x + a.w > b.x (and the same for y), so touching edges do not hit.
+
+#define boxOverlap(ax, ay, aw, ah, bx, by, bw, bh) \
+    ((ax) < (bx) + (bw) && (ax) + (aw) > (bx) && (ay) < (by) + (bh) && (ay) + (ah) > (by))
+
+// A mover needs the swept test once it moves more than half its own box in a frame
+#define isFastMover(dx, dy, w, h)   (abs(dx) * 2 > (w) || abs(dy) * 2 > (h))
+
+// Where a mover now at pos started this frame's step, in the frame of entities that
+// scroll by -scroll afterwards.  At a scroll boundary pos does not change (scroll == step),
+// so the move starts at pos; otherwise scroll is 0 and it started at pos - step.
+#define sweepStart(pos, step, scroll)   ((pos) - (step) + (scroll))
+
+// Box a at (ax, ay) moving by (dx, dy) this frame against a box b held still.
+// Slow movers get the plain overlap test at the end position; fast movers are swept
+// along the whole segment (integer only), so they cannot tunnel through b.
+u16 sweptBoxHit(s16 ax, s16 ay, s16 aw, s16 ah, s16 dx, s16 dy,
+                s16 bx, s16 by, s16 bw, s16 bh);
+
+// Sprite vs sprite using the generated hitboxes (hitbox.h): tight boxes first, then the
+// 1-bit masks are compared only when the boxes overlap.  Sprites are at their SPR position.
+u16 spriteHit(const SpriteHitboxes* a, u16 fa, s16 ax, s16 ay,
+              const SpriteHitboxes* b, u16 fb, s16 bx, s16 by);
+
+// As spriteHit, with a moving by (dx, dy) this frame.  Fast movers are swept on the tight
+// boxes only (the masks can't be swept); slow movers get the mask test at the end position.
+u16 spriteSweptHit(const SpriteHitboxes* a, u16 fa, s16 ax, s16 ay, s16 dx, s16 dy,
+                   const SpriteHitboxes* b, u16 fb, s16 bx, s16 by);
+
+#endif // COLLISION_H
@@ -18,12 +18,45 @@
 #define MMAPSIZED2              -512
 #define MAPSIZEM1               1023
 
+// --- Sector Coordinates ---
+// A level position is a sector index plus an s16 offset inside it (WorldAxis, see world.c).
+// A sector is one MAPSIZE window, so per-entity math stays 16-bit and only crossings touch
+// the index.  With SECTOR_COUNT 1 the level is the single wrapped MAPSIZE window.
+#define SECTOR_SHIFT            10  // log2(MAPSIZE)
+#define SECTOR_SIZE             (1 << SECTOR_SHIFT)
+#define SECTOR_COUNT            1   // Sectors per axis, power of two (the level wraps at SECTOR_COUNT)
+#define SECTOR_MASK             (SECTOR_COUNT - 1)
+#define SECTOR_REACH            1   // Anchored entities further than this many sectors away are parked
+#define SECTOR_PARKED           0x4000 // Local coordinate of a parked entity (off screen, outside the mine grid)
+
+// --- World Map Streaming ---
+// The world is MAPSIZE pixels square and is built from 8x8-tile chunks of Star_Map.png.
+// Each world sector byte holds a chunk index plus flip bits (see world_sectors in game_data.c).
+#define WORLD_TILES             128 // MAPSIZE / 8
+#define WORLD_TILES_MASK        127
+#define WORLD_SECTORS           16  // WORLD_TILES / WORLD_SECTOR_TILES
+#define WORLD_SECTOR_TILES      8
+#define WORLD_SECTOR_CHUNK_MASK 0x1F
+#define WORLD_SECTOR_HFLIP      0x20
+#define WORLD_SECTOR_VFLIP      0x40
+#define STAR_MAP_CHUNKS_W       8   // Star_Map.png is 64x32 tiles -> 8x4 chunks
+
+#define PLANE_B_TILES_W         64  // Hardware plane size (tiles)
+#define PLANE_B_TILES_H         32
+#define MAP_STREAM_MAX_STEP     2   // Columns/rows streamed per frame before falling back to a full redraw
+
 // --- Sine/Cosine Table ---
 // Calculate the number of unique steps (excluding the wrap-around entry)
 // SINCOS_TABLE_STEPS definition will need to be near the actual table definition (e.g., in game_data.c or a math_utils.c)
 
 // --- Sound effects ---
-#define SFX_LASER               64  // 0-63 are reserved for music <- not used with XGM2
+#define SFX_CHANNELS            2   // PCM channels managed by sfx.c (CH2, CH3)
+#define SFX_PCM_BYTES_PER_FRAME 222 // XGM2 PCM at 13.3 kHz / 60 fps, for estimating cue length
+
+// --- Palette effects ---
+#define PAL_LINES               4
+#define PAL_COLORS              16
+#define SHIELD_PAL_FRAMES       11  // Frames each shield flash palette is held (swap once the timer passes 10)
 
 // --- Spacecraft properties ---
 #define SHIP_ROT_SPEED          3
@@ -35,19 +68,112 @@
 // --- EBullet properties ---
 #define NEBULLET                8
 #define NEBULLET_TIMER_MAX      8
+#define EFIRE_WINDOW_FRAMES     (NEBULLET_TIMER_MAX + 1) // Frames per fire window; efire_cooldown_timer counts windows
 
 // --- SBullet properties ---
 #define NSBULLET                3  // Only one spread-shot at a time
 #define NSBULLET_TIMER_MAX      45
+#define SBULLET_SPREAD          3  // Shots per spread
+
+// --- Projectile pools ---
+#define POOL_SIZE_LEVELS        8  // Entries in level_pool_sizes
 
 // --- Fighter properties ---
-#define NFIGHTER_MAX            30
+#define NFIGHTER_MAX            30  // <= 32, fighters are bits in fighter_visible
+#define FIGHTER_FRAME           0   // Fighters are not animated, always frame 0 of fighter_sprite_res
 #define FIGHTER_RATE            128 // Rate at which Fighters regenerate (currently unused but good to keep)
 
+// --- Space mine properties ---
+#define NMINE_MAX               4   // Mine pool size (<= 8, mines are bits in a u8 grid cell)
+#define MINE_PLACE_DELAY        30  // Frames between mine drops
+#define MINE_GRID_SHIFT         6   // 64 px bucket cells
+#define MINE_GRID_DIM           16  // MAPSIZE >> MINE_GRID_SHIFT
+#define MINE_TRIGGER_MARGIN     4   // Proximity fuse around the mine's tight hitbox
+#define MINE_GRID_REACH         (PLAYER_SPRITE_HIT_MAX + MINE_TRIGGER_MARGIN - SPACE_MINE_HIT_MIN) // Ship box end to trigger box start (hitbox_table.h)
+#define MINE_ARMED_FRAME        1   // space_mine_res frame once armed
+#define MINE_ARM_FRAMES         30  // Arming animation holds frame 0 this long
+
+// --- Explosion properties ---
+#define EXPLOSION_MAX           8   // Concurrent explosions (fighters and mines share the pool), <= 8 for explosion_visible
+
+// --- Sprite animations ---
+#define ANIM_MAX                (EXPLOSION_MAX + NMINE_MAX) // Explosions and arming mines
+#define ANIM_HOLD               0   // Duration that completes the animation on entering that frame
+
+// --- Sprite atlas ---
+#define SPRITE_ENGINE_TILES     64  // VRAM left to the sprite engine for sprites outside the atlas
+
 // --- HUD properties ---
 #define BAR_WIDTH_TILES 8
 #define STRIPS_PER_TILE 8
 
+#define HUD_DIRTY_PLAYER    0x01
+#define HUD_DIRTY_FIGHTERS  0x02
+#define HUD_DIRTY_LEVEL     0x04
+#define HUD_DIRTY_SCORE     0x08
+#define HUD_DIRTY_ALL       0x0F
+
+// --- Game events ---
+#define GAME_EVENT_RING     64  // Power of two; events per frame before an early drain
+
+// HUD_ON_WINDOW draws the HUD on the (non-scrolling) WINDOW plane over the top rows,
+// leaving BG_A free to scroll.  Set to 0 for the old layout drawn directly on BG_A.
+#define HUD_ON_WINDOW   1
+#if HUD_ON_WINDOW
+#define HUD_PLANE       WINDOW
+#define HUD_WINDOW_ROWS 3   // Rows 0-2 hold the score bars, scores and level
+#else
+#define HUD_PLANE       BG_A
+#define HUD_WINDOW_ROWS 0
+#endif
+
+// --- Input ---
+#define INPUT_HISTORY           16  // Power of two; frames of held masks kept by the input service
+#define INPUT_LATENCY_PROBE     0   // 1 = measure press-to-screen latency and show it in the HUD
+#define INPUT_PROBE_TIMEOUT     30  // Frames before an unanswered press is dropped by the probe
+
+// --- Fixed timestep ---
+#define SIM_HZ                  60  // Simulation ticks per second; all timers and speeds are in these ticks
+#define SIM_MAX_TICKS           3   // Most ticks run for one rendered frame (catch-up cap)
+
+// --- Frame pacing ---
+#define FRAME_PACE_LOG          8   // Power of two; most recent overruns kept with entity counts
+#define FRAME_PACE_SHOW         120 // Frames the HUD drop indicator stays up after a drop
+#ifdef DEBUG
+#define FRAME_PACE_INDICATOR    1   // Debug builds show dropped frames in the HUD
+#else
+#define FRAME_PACE_INDICATOR    0
+#endif
+
+// --- Stack probe ---
+#define STACK_PROBE_BYTES       1024   // Painted below main; keep inside SGDK's stack reserve
+#define STACK_PROBE_SKIP        64     // Bytes below paintStack's frame left unpainted
+#define STACK_PAINT             0xA55A
+
+// --- Snapshot rewind ---
+#define REWIND_BYTES            8192 // Power of two; RAM for XOR/RLE deltas
+#define REWIND_RECORDS          64   // Power of two; most deltas kept
+#define REWIND_INTERVAL         8    // Frames between snapshots
+#define REWIND_RETRY_STEPS      16   // Snapshots undone by a practice retry (MODE), ~2 s
+
+// --- Stress scenarios (stress.h) ---
+#ifndef STRESS_SCENARIO                // The cycle harness ROMs set it with -D (CMakeLists.txt)
+#define STRESS_SCENARIO         0      // 0 = normal game; STRESS_FIGHTERS..STRESS_MINE_CROWD runs that scenario
+#endif
+#define STRESS_FRAMES           600    // Frames per run before the report
+#define STRESS_SEED             0x5EED // Placement and AI are reproducible run to run
+#define STRESS_HIST_BIN         160    // Histogram bin width in subticks (1/8 NTSC frame)
+#define STRESS_HIST_BINS        16     // Last bin also counts anything longer
+#define STRESS_BUDGET           1280   // Subticks of CPU per frame before it counts as an overrun (NTSC)
+#define STRESS_CROWD_X          240    // Mine crowd centre, clear of the player
+#define STRESS_CROWD_Y          160
+#define STRESS_CROWD_PERIOD     90     // Frames between regrouping the crowd and re-laying mines
+
+// --- SRAM save ---
+#define SAVE_MAGIC              0x5301 // 'S' + layout version; bump when SaveRecord changes
+#define SAVE_SLOTS              2      // Records written alternately
+#define SAVE_SLOT_BYTES         16     // SRAM bytes per slot (>= sizeof(SaveRecord))
+
 // --- Debug Text ---
 #define DEBUG_TEXT_LEN          16
 
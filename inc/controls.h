@@ -0,0 +1,31 @@
+// controls.h
+#ifndef CONTROLS_H
+#define CONTROLS_H
+
+// Control styles, chosen on the title screen (control_style)
+#define CONTROL_ROTATE      0   // Left/right turn, up thrusts, down reverses
+#define CONTROL_DIRECT      1   // Dpad points and thrusts in 8 directions
+#define CONTROL_STRAFE      2   // As CONTROL_DIRECT, holding Z keeps the current facing (6-button pad)
+#define CONTROL_STYLE_COUNT 3
+
+#define DPAD_MASK           (BUTTON_UP | BUTTON_DOWN | BUTTON_LEFT | BUTTON_RIGHT) // Low 4 bits of the pad
+
+typedef struct {
+    s16 rotation_index;     // -1 when the dpad is released
+    s16 vx;                 // Thrust, -sin_fix_d2/-cos_fix_d2 of rotation_index
+    s16 vy;
+} DpadVector;
+
+typedef struct {
+    const char* name;               // Shown on the title screen
+    s16 boost_factor;
+    void (*steer)(u16 value);       // Sets player rotation and thrust from the pad
+} ControlStyle;
+
+extern const ControlStyle control_styles[CONTROL_STYLE_COUNT];
+
+extern void (*steerPlayer)(u16 value); // Handler of the bound style, called by handleInput
+
+void bindControlStyle(s16 style);   // Once when the title screen exits
+
+#endif // CONTROLS_H
@@ -5,6 +5,9 @@
 // Struct Bullet is defined in globals.h
 
 void init_eBullets(void);
+void initFighterFire(void);       // All fighters ready, called with initFighters
+void tickFighterCooldowns(void);  // Once per frame
+void rebuildFighterFire(void);    // Ready queue from fighter_cooldown (snapshot restore)
 void fire_eBullet(void);
 void update_eBullets(void);
 
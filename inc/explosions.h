@@ -0,0 +1,18 @@
+// explosions.h
+#ifndef EXPLOSIONS_H
+#define EXPLOSIONS_H
+
+// Struct Explosion is defined in globals.h
+
+#define EXPLOSION_FIGHTER   0
+#define EXPLOSION_MINE      1
+
+void initExplosions(void);
+s16 spawnExplosion(u16 kind, s16 x, s16 y); // -1 if the pool is full (the effect is skipped)
+void updateExplosions(void);
+void drawExplosions(void);
+s16 explosionSize(u16 kind);               // Sprite size in pixels, for the on-screen test
+void clearExplosions(void);
+void respawnExplosionSprites(void);
+
+#endif // EXPLOSIONS_H
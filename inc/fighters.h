@@ -6,6 +6,8 @@
 
 void initFighters(void);
 void updateFighters(void);
+void drawFighters(void);
 void collideFighters(void);
+void killFighter(s16 i);
 
 #endif // FIGHTERS_H
\ No newline at end of file
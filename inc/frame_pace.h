@@ -0,0 +1,27 @@
+// frame_pace.h
+#ifndef FRAME_PACE_H
+#define FRAME_PACE_H
+
+#include <genesis.h>
+
+// Frame-pacing monitor: the main loop should see exactly one vblank (vtimer tick) per
+// iteration.  Every extra tick is a dropped frame.
+
+typedef struct {
+    u16 frame;          // framesSampled() when the overrun was seen
+    s16 game_nframe;
+    u8 dropped;         // Vblanks missed by that frame
+    u8 fighters;        // Live entities at the time
+    u8 bullets;         // Player + spread shots
+    u8 ebullets;
+    u8 explosions;
+    u8 mines;
+} FrameOverrun;
+
+void initFramePace(void);
+void updateFramePace(void);         // Once per main-loop frame, after SYS_doVBlankProcess
+void resyncFramePace(void);         // After a screen that runs its own loop (level_up)
+void drawFramePace(void);           // Debug indicator on the HUD (FRAME_PACE_INDICATOR)
+const FrameOverrun* frameOverrun(u16 age); // age 0 = most recent, NULL if not recorded
+
+#endif // FRAME_PACE_H
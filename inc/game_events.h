@@ -0,0 +1,34 @@
+// game_events.h
+#ifndef GAME_EVENTS_H
+#define GAME_EVENTS_H
+
+#include <genesis.h> // For u8, s16
+
+// Event types
+#define EVT_KILL            1   // Player destroyed a fighter (index = fighter)
+#define EVT_PLAYER_HIT      2   // Player hit by an enemy (index = fighter that rammed, -1 for a bullet)
+#define EVT_MINE_DETONATE   3   // Mine went off (index = fighter caught, -1 if the player set it off)
+#define EVT_SHIELD_UP       4   // Shield raised
+
+// Event causes (what did it)
+#define CAUSE_NONE          0
+#define CAUSE_BULLET        1   // Main gun
+#define CAUSE_SBULLET       2   // Spread gun
+#define CAUSE_SHIELD        3   // Rammed with the shield up
+#define CAUSE_FIGHTER       4   // Rammed with the shield down
+#define CAUSE_EBULLET       5   // Enemy shot
+#define CAUSE_MINE          6
+
+typedef struct {
+    u8 type;
+    u8 cause;
+    s16 index;
+    s16 source;     // Entity that caused it (mine index for EVT_MINE_DETONATE), -1 if none
+} GameEvent;
+
+void initGameEvents(void);
+void pushGameEvent(u8 type, u8 cause, s16 index, s16 source);
+void resolveGameEvents(void); // Once per frame, after all collision checks and before drawHud
+void setGameEventLogger(void (*logger)(const GameEvent* event));
+
+#endif // GAME_EVENTS_H
@@ -14,9 +14,29 @@ typedef struct {
     s16 bvxrem;
     s16 bvyrem;
     s16 new_bullet; // Renamed from 'new' to avoid keyword clash if C++ compiler/linter
+    s16 next;       // Pool links: free list uses next only, live list is doubly linked
+    s16 prev;
     Sprite* sprite_ptr;
 } Bullet;
 
+// Intrusive free-list/live-list over a Bullet array (see bullet_pool.c)
+typedef struct {
+    Bullet* items;
+    u16 size;       // Storage slots
+    u16 capacity;   // Max live at once, set per level (<= size)
+    u16 live_count;
+    s16 free_head;
+    s16 live_head;
+} BulletPool;
+
+// Per-level projectile pool sizes
+typedef struct {
+    u8 bullets;
+    u8 ebullets;
+    u8 sbullets;
+    u8 mines;
+} PoolSizes;
+
 typedef struct {
     s16 status;
     s16 x;
@@ -38,6 +58,46 @@ typedef struct {
     Sprite* sprite_ptr;
 } Fighter;
 
+// One axis of a level position: sector * SECTOR_SIZE + offset, offset in [0, SECTOR_SIZE)
+typedef struct {
+    s16 sector;
+    s16 offset;
+} WorldAxis;
+
+typedef struct {
+    s16 status;     // 0 free, 1 arming, 2 armed, -9 detonated this frame
+    s16 x;          // Screen-relative, derived from wx/wy each tick
+    s16 y;
+    WorldAxis wx;   // Where the mine was dropped (mines never move in the level)
+    WorldAxis wy;
+    s16 anim;       // Arming animation slot, -1 once armed (see anim.c)
+    Sprite* sprite_ptr;
+} Mine;
+
+typedef struct {
+    s16 x;
+    s16 y;
+    s16 anim;       // Animation slot playing it, -1 when the explosion slot is free
+    u8 kind;        // EXPLOSION_FIGHTER / EXPLOSION_MINE
+    Sprite* sprite_ptr;
+} Explosion;
+
+// Frame-duration table for one sprite resource (anim.c)
+typedef struct {
+    const u8* durations;        // Game frames per sprite frame; ANIM_HOLD ends the animation on that frame
+    u8 num_frames;
+    u8 loop;                    // Restart after the last frame instead of completing
+    void (*done)(u16 owner);    // Completion callback, or NULL
+} AnimDef;
+
+typedef struct {
+    const AnimDef* def;         // NULL when the slot is free
+    Sprite** sprite;            // The owner's sprite_ptr field (stable across snapshot restores)
+    u16 owner;                  // Index passed to def->done
+    u8 frame;
+    u8 delay;                   // Game frames left on this frame
+} Anim;
+
 
 // --- Global Variables (declared as extern) ---
 
@@ -56,6 +116,9 @@ extern s16 scroll_boundary_y2; // Renamed BY2
 // Background Scroll Offsets
 extern s16 scroll_a_x; extern s16 scroll_a_y; // Plane A (Near)
 extern s16 scroll_b_x; extern s16 scroll_b_y; // Plane B (Far)
+
+// Camera in sector coordinates: the level position of screen (0,0)
+extern WorldAxis camera_x; extern WorldAxis camera_y;
 // extern s16 scroll_x; extern s16 scroll_y; // Overall map scroll if different (seems covered by dx/dy from player)
 
 // Sine/Cosine Tables
@@ -65,6 +128,9 @@ extern const s16 sin_fix_d2[];
 extern const s16 cos_fix_d2[];
 #define SINCOS_TABLE_STEPS (24) // Hardcode for now based on data, or calculate in game_data.c
 
+// World map (streamed into BG_B by background.c)
+extern const u8 world_sectors[WORLD_SECTORS * WORLD_SECTORS];
+
 // Player Sprite
 extern Sprite* player_sprite;
 
@@ -93,16 +159,10 @@ extern s16 player_scroll_delta_x; // Renamed dx (player's contribution to scroll
 extern s16 player_scroll_delta_y; // Renamed dy
 extern s16 boost_factor;
 
-// Player D-control
-extern u8 dpadUp;
-extern u8 dpadDown;
-extern u8 dpadLeft;
-extern u8 dpadRight;
-
 // Bullet Pool and related
 extern Bullet bullets[NBULLET];
+extern BulletPool bullet_pool;
 extern u16 fire_cooldown_timer; // Renamed fire_cooldown
-extern u16 current_bullet_index; // Renamed bullet_c
 extern u16 new_bullet_delay_timer; // Renamed bullet_timer
 // extern s16 bullet_vx_req; // Renamed bvx - seems calculated on the fly
 // extern s16 bullet_vy_req; // Renamed bvy
@@ -111,20 +171,32 @@ extern u16 new_bullet_delay_timer; // Renamed bullet_timer
 
 // E-Bullet Pool
 extern Bullet ebullets[NEBULLET];
+extern BulletPool ebullet_pool;
 extern u16 efire_cooldown_timer; 
 extern u16 efire_cooldown_timer_min;
-extern u16 current_ebullet_index; 
+extern u16 fighter_cooldown[NFIGHTER_MAX]; // Frames until each fighter may fire again, 0 = ready
 extern u16 new_ebullet_delay_timer; 
 
 // S-Bullet Pool
 extern Bullet sbullets[NSBULLET];
+extern BulletPool sbullet_pool;
 extern u16 sfire_cooldown_timer; 
-extern u16 current_sbullet_index; 
 extern u16 new_sbullet_delay_timer; 
 
+// Projectile pool sizes by level (game_level - 1, last entry repeats)
+extern const PoolSizes level_pool_sizes[POOL_SIZE_LEVELS];
+
+// Explosion Pool (fighters and mines)
+extern Explosion explosions[EXPLOSION_MAX];
+
+// Sprite animations (anim.c)
+extern Anim anims[ANIM_MAX];
+
 // Fighter Pool and related
 extern Fighter fighters[NFIGHTER_MAX];
-extern Fighter fexplode[NFIGHTER_MAX];
+extern u32 fighter_visible;   // On-screen bitsets, rebuilt each frame by updateVisibility
+extern u8 mine_visible;
+extern u8 explosion_visible;
 extern s16 active_fighter_count; // Renamed nfighter (maybe better to count active ones)
 extern s16 fighter_speed_1;
 extern s16 fighter_speed_2;
@@ -148,22 +220,33 @@ extern u16 ind_sc; // for score tiles
 
 // Scores and Levels
 extern s16 player_score;
-extern s16 player_score_old;
 extern u16 fighters_score;
-extern u16 fighters_score_old;
 extern u16 score_to_win;
 extern u16 game_level;
-extern u16 game_level_old;
 extern u16 game_score;
-extern u16 game_score_old;
+extern u16 high_score;  // Persisted in SRAM (save.c)
+extern u16 best_level;
 
 // HUD
+extern u16 hud_dirty; // HUD_DIRTY_* parts to redraw in drawHud
+
 extern u16 player_tiles;
 // extern u16 player_tiles_red;
 extern u16 coffset;
 extern u16 STRIP_TILE_8_IDX;
 extern u16 EMPTY_BAR_TILE_IDX;
 
+// Input service (input.c), sampled once per frame
+extern u16 joy_held;     // Buttons down this frame
+extern u16 joy_pressed;  // Went down this frame
+extern u16 joy_released; // Went up this frame
+extern u16 input_frame;  // Frames sampled since initInput
+
+// Frame pacing (frame_pace.c)
+extern u16 frame_drops_total;       // Vblanks missed by the main loop
+extern u16 frame_drop_streak;       // Missed in a row up to the last frame
+extern u16 frame_drop_streak_max;
+
 // Title screen
 extern s16 control_style;
 extern s16 control_style_old;
@@ -174,10 +257,11 @@ extern u16 new_shield_delay_timer;
 extern u16 shield_delay_max;
 extern u16 shield_timer;
 extern u16 shield_duration;
-extern u16 shield_pal;
 extern s16 shield_status;
-extern u16 shield_pal_timer;
-extern u16 shield_pal_timer_switch;
+
+// Palette effects
+extern u16 palette_dma_bytes;       // CRAM bytes queued so far this frame
+extern u16 palette_dma_bytes_frame; // CRAM bytes queued last frame
 
 //Boost
 extern u16 player_boost_timer;
@@ -187,14 +271,9 @@ extern u16 player_boost_delay_timer_max; // How often the player can boost
 extern s16 player_boost_status;
 
 // Space Mines
-extern s16 mine_status; // Shield is off.
-extern s16 mine_x;
-extern s16 mine_y;
-extern u16 mine_timer;   // Time for mine to arm itself
-extern u16 mine_timer_max;
-extern s16 mexplode_status;
-extern Sprite* mine_sprite_ptr;
-extern Sprite* mexplode_sprite_ptr;
+extern Mine mines[NMINE_MAX];
+extern u16 mine_cap;             // Mines allowed at once this level
+extern u16 new_mine_delay_timer; // Frames since the last mine was placed
 
 
 #endif // GLOBALS_H
\ No newline at end of file
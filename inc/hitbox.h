@@ -0,0 +1,24 @@
+// hitbox.h
+#ifndef HITBOX_H
+#define HITBOX_H
+
+// Per-frame collision data generated from the sprite sheets in resources.res by
+// tools/gen_hitboxes.py (res/hitbox_table.c/h, regenerate after editing a sheet).
+
+typedef struct {
+    u8 x;   // Tight box of the opaque pixels, relative to the sprite's top-left
+    u8 y;
+    u8 w;   // 0 for an empty frame (never hits)
+    u8 h;
+} Hitbox;
+
+typedef struct {
+    const Hitbox* boxes;    // One per frame (animation rows one after the other)
+    const u16* masks;       // mask_rows per frame, bit 15 = left pixel; NULL for sprites wider than 16 px
+    u16 num_frames;
+    u16 mask_rows;
+} SpriteHitboxes;
+
+#include "hitbox_table.h"
+
+#endif // HITBOX_H
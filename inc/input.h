@@ -0,0 +1,16 @@
+// input.h
+#ifndef INPUT_H
+#define INPUT_H
+
+// joy_held / joy_pressed / joy_released are in globals.h, sampled by updateInput
+
+void initInput(void);
+void updateInput(void);                 // Once per frame, before anything reads the pad
+u16 inputHistory(u16 age);              // Held mask age frames ago (0 = this frame, < INPUT_HISTORY)
+u16 inputRepeat(u16 buttons, u16 delay);// Pressed, or held for each further delay frames (menu auto-repeat)
+
+// Latency probe (INPUT_LATENCY_PROBE): call where a press first becomes visible
+void inputResponse(u16 buttons);
+void drawInputLatency(void);
+
+#endif // INPUT_H
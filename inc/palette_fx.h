@@ -0,0 +1,21 @@
+// palette_fx.h
+#ifndef PALETTE_FX_H
+#define PALETTE_FX_H
+
+#include <genesis.h> // For u16, Palette
+
+// A looping sequence of palettes, each held for durations[k] frames
+typedef struct {
+    const Palette* const* keys;
+    const u16* durations;
+    u16 num_keys;
+} PaletteCycle;
+
+void initPaletteFx(void);
+void setPaletteFx(u16 pal, const u16* colors);   // Uploads only the colours that differ from CRAM
+void startPaletteCycle(u16 pal, const PaletteCycle* cycle);
+void stopPaletteCycle(u16 pal);
+void fadePaletteTo(u16 pal, const u16* colors, u16 frames);
+void updatePaletteFx(void);                       // Once per frame, before SYS_doVBlankProcess
+
+#endif // PALETTE_FX_H
@@ -0,0 +1,14 @@
+// save.h
+#ifndef SAVE_H
+#define SAVE_H
+
+#include <genesis.h>
+
+// Battery-backed SRAM: high score, best level and control style.  Two record slots are
+// written alternately, so a reset mid-write leaves the previous record intact.
+// SRAM is only touched here, and only from level_up and the title screen.
+
+void loadSave(void);        // Boot: newest valid slot into high_score, best_level, control_style
+void saveProgress(void);    // Fold game_score/game_level/control_style in, write if anything changed
+
+#endif // SAVE_H
@@ -0,0 +1,24 @@
+// sfx.h
+#ifndef SFX_H
+#define SFX_H
+
+#include <genesis.h> // For u16
+
+// One entry per cue in the sfx_defs table (sfx.c)
+typedef enum {
+    SFX_LASER,       // Main gun
+    SFX_SBULLET,     // Spread gun
+    SFX_ELASER,      // Enemy shot
+    SFX_EXPLODE,     // Fighter destroyed by the player
+    SFX_EXPLODE_HIT, // Player hit (half rate)
+    SFX_MEXPLODE,    // Space mine detonation
+    SFX_TURBO,       // Boost
+    SFX_DING,        // Shield up
+    SFX_COUNT
+} SfxId;
+
+void initSfx(void);
+void playSfx(SfxId id); // Request a cue; duplicates in the same frame are merged
+void updateSfx(void);   // Once per frame: arbitrate channels and issue driver commands
+
+#endif // SFX_H
@@ -4,5 +4,6 @@
 
 void enableShield(void);
 void shield_animate(void);
+void restoreShieldFx(void);
 
 #endif // SHIELD_H
\ No newline at end of file
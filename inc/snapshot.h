@@ -0,0 +1,44 @@
+// snapshot.h
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "globals.h"
+
+// Every global that makes up the simulation between two frames.  The snapshot struct,
+// save and restore are all generated from this list, so a new piece of state only needs a line here.
+#define SNAPSHOT_FIELDS(X) \
+    X(player_x) X(player_y) X(player_vx) X(player_vy) \
+    X(player_vx_applied) X(player_vy_applied) X(player_x_remainder) X(player_y_remainder) \
+    X(player_rotation_index) X(player_rotation_iframe) \
+    X(player_thrust_delay_timer) X(player_thrust_counter) \
+    X(player_thrust_momentum_x) X(player_thrust_momentum_y) \
+    X(player_scroll_delta_x) X(player_scroll_delta_y) \
+    X(player_boost_timer) X(player_boost_delay_timer) X(player_boost_status) \
+    X(scroll_a_x) X(scroll_a_y) X(scroll_b_x) X(scroll_b_y) X(camera_x) X(camera_y) \
+    X(bullets) X(bullet_pool) X(new_bullet_delay_timer) \
+    X(ebullets) X(ebullet_pool) X(new_ebullet_delay_timer) X(efire_cooldown_timer) \
+    X(sbullets) X(sbullet_pool) X(new_sbullet_delay_timer) \
+    X(fighters) X(fighter_cooldown) X(active_fighter_count) \
+    X(fighter_speed_1) X(fighter_speed_2) X(game_ai_decision) \
+    X(mines) X(mine_cap) X(new_mine_delay_timer) \
+    X(explosions) X(anims) \
+    X(shield_status) X(shield_timer) X(new_shield_delay_timer) \
+    X(player_score) X(fighters_score) X(score_to_win) X(game_level) X(game_score) \
+    X(game_nframe)
+
+#define SNAPSHOT_DECLARE(v) __typeof__(v) v;
+
+typedef struct {
+    u16 rng_seed;   // random() is reseeded with this at save, so the stream after a restore matches
+    SNAPSHOT_FIELDS(SNAPSHOT_DECLARE)
+} GameSnapshot;
+
+void saveSnapshot(GameSnapshot* s);
+void loadSnapshot(const GameSnapshot* s);   // Rebuilds sprites, fire queue, shield palette and HUD
+
+// Rewind ring: XOR/RLE deltas between snapshots taken every REWIND_INTERVAL frames
+void initRewind(void);          // Start of each level (deltas never cross a level change)
+void recordRewind(void);        // Once per frame, at the end of the frame's simulation
+u16 rewindState(u16 steps);     // Go back up to steps snapshots, returns how many were undone
+
+#endif // SNAPSHOT_H
@@ -1,8 +1,14 @@
-// shield.h
+// spaceMines.h
 #ifndef SPACE_MINES_H
 #define SPACE_MINES_H
 
+// Struct Mine is defined in globals.h
+
+void initMines(void);
 void placeMine(void);
 void updateMine(void);
+void drawMines(void);
+void clearMines(void);
+void respawnMineSprites(void);
 
 #endif // SPACE_MINES_H
\ No newline at end of file
@@ -0,0 +1,18 @@
+// sprite_atlas.h
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <genesis.h>
+
+// Every frame of the game's sprite sheets is uploaded to VRAM once, just below the
+// sprite engine's own (SPRITE_ENGINE_TILES) area.  Atlas sprites share those tiles, and
+// a frame change only rewrites the sprite's tile index; nothing is DMA'd.
+
+void initSpriteAtlas(void);     // Once after SPR_initEx, before any sprite is added
+Sprite* addAtlasSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attribut); // SPR_addSprite for atlas sheets
+
+// Title, background and HUD tiles are loaded upward from TILE_USER_INDEX and must end
+// (end is exclusive) at or below the atlas.  Stops with SYS_die rather than corrupt sprites.
+void checkBelowAtlas(u16 end, const char* what);
+
+#endif // SPRITE_ATLAS_H
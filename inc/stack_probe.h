@@ -0,0 +1,12 @@
+// stack_probe.h
+#ifndef STACK_PROBE_H
+#define STACK_PROBE_H
+
+#include <genesis.h>
+
+// Stack high-water probe: STACK_PROBE_BYTES below main's frame are painted at boot,
+// and the deepest overwritten word shows how much stack the game has used since.
+void paintStack(void);          // Early in main, before anything deep runs
+u16 stackHighWater(void);       // Bytes used below the paint start (STACK_PROBE_BYTES = all of it)
+
+#endif // STACK_PROBE_H
@@ -0,0 +1,49 @@
+// stress.h
+#ifndef STRESS_H
+#define STRESS_H
+
+#include "globals.h" // STRESS_SCENARIO
+
+// Load scenarios for profiling (STRESS_SCENARIO in constants.h).  A scenario replaces the
+// title screen, runs STRESS_FRAMES frames with seeded placement and scripted input, then
+// prints per-section times and a frame-time histogram as CSV on the KDebug log
+// (BlastEm/Gens console) and halts.  Times are SGDK subticks, 1280 per NTSC frame.
+// CYCLE_SCENARIOS in CMakeLists.txt (opt-in) builds these ROMs and runs them on tools/cyclerun,
+// which times stressBegin..stressEnd in exact 68000 cycles instead.
+#define STRESS_FIGHTERS     1   // All NFIGHTER_MAX fighters on screen
+#define STRESS_BULLETS      2   // Every player and enemy bullet slot in flight
+#define STRESS_EXPLOSIONS   3   // Explosion pool kept full
+#define STRESS_BOOST_WRAP   4   // Boosting straight across world wraps
+#define STRESS_MINE_CROWD   5   // Armed mines detonating inside a fighter crowd
+#define STRESS_COUNT        5
+
+// Timed sections of the main loop (summed over a frame's simulation ticks)
+#define STRESS_T_PLAYER     0   // handleInput, boost, physics
+#define STRESS_T_COLLIDE    1   // collideFighters, shield
+#define STRESS_T_BULLETS    2   // Player bullets and spread shots
+#define STRESS_T_MINES      3
+#define STRESS_T_FIGHTERS   4
+#define STRESS_T_EXPLOSIONS 5
+#define STRESS_T_DRAW       6   // Sprite placement and map streaming, once per frame
+#define STRESS_T_EBULLETS   7   // Visibility, enemy bullets and fire
+#define STRESS_T_EVENTS     8
+#define STRESS_T_SCROLL     9   // Scroll values, rewind record
+#define STRESS_T_PRESENT    10  // Player sprite, HUD, palette, sound, SPR_update
+#define STRESS_SECTIONS     11
+
+#if STRESS_SCENARIO
+#define STRESS_BEGIN()          stressBegin()
+#define STRESS_MARK(section)    stressMark(section)
+#define STRESS_END()            stressEnd()
+#else
+#define STRESS_BEGIN()
+#define STRESS_MARK(section)
+#define STRESS_END()
+#endif
+
+void stressSetup(void);         // After the entities are initialised, before the first frame
+void stressBegin(void);         // Top of each frame, after updateInput: scripted input, frame clock
+void stressMark(u16 section);   // Time since the previous mark goes to section
+void stressEnd(void);           // Before vblank; reports and halts after STRESS_FRAMES
+
+#endif // STRESS_H
@@ -0,0 +1,15 @@
+// timestep.h
+#ifndef TIMESTEP_H
+#define TIMESTEP_H
+
+#include <genesis.h>
+
+// The simulation always advances in SIM_HZ ticks.  Each vblank adds SIM_HZ per elapsed
+// vblank to an accumulator that pays refresh_hz per tick, so PAL (50 Hz) gets six ticks
+// every five frames and a frame that missed vblank catches up on the next one.
+
+void initTimestep(void);    // Boot: detects NTSC/PAL
+void resyncTimestep(void);  // After a screen that runs its own loop (level_up)
+u16 timestepTicks(void);    // Once per rendered frame: simulation ticks to run (<= SIM_MAX_TICKS)
+
+#endif // TIMESTEP_H
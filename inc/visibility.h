@@ -0,0 +1,15 @@
+// visibility.h
+#ifndef VISIBILITY_H
+#define VISIBILITY_H
+
+// On-screen bitsets (fighter_visible, mine_visible, explosion_visible) are in globals.h.
+// Bit i is set when entity i is live and its box overlaps the screen this frame.
+
+#define VIS_TEST(mask, i)   (((mask) >> (i)) & 1)
+
+void updateVisibility(void); // Rebuild the bitsets; call once all movement for the frame is done
+s16 visNext(u32* mask);      // Pop the lowest set bit of mask, -1 when it is empty
+
+// Usage:  u32 m = fighter_visible;  for (s16 i = visNext(&m); i >= 0; i = visNext(&m)) { ... }
+
+#endif // VISIBILITY_H
@@ -0,0 +1,21 @@
+// world.h
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <genesis.h>
+
+// Struct WorldAxis is defined in globals.h
+
+// Entities that recycle around the camera (fighters) keep screen-relative s16 positions
+// and wrap inside the MAPSIZE window.  Entities pinned to the level (mines) keep a
+// WorldAxis anchor and get their screen-relative position from localFromAnchor().
+#define WRAP_WINDOW(v)  do { if ((v) > MAPSIZED2) (v) -= MAPSIZE; \
+                             else if ((v) < MMAPSIZED2) (v) += MAPSIZE; } while (0)
+
+void initCamera(void);          // Level start: camera at sector 0, offset 0
+void advanceCamera(void);       // Once per tick after updatePhysics: follow player_scroll_delta_x/y
+
+void anchorAt(WorldAxis* a, const WorldAxis* cam, s16 local);   // Level position of screen coordinate local
+s16 localFromAnchor(const WorldAxis* a, const WorldAxis* cam);  // Screen coordinate, or SECTOR_PARKED
+
+#endif // WORLD_H
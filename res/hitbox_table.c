@@ -0,0 +1,153 @@
+// hitbox_table.c - generated by tools/gen_hitboxes.py from resources.res, do not edit
+#include <genesis.h>
+#include "hitbox.h"
+
+// player_sprite_res "player_sprite_sheet.png": 24 frame(s) of 16x16
+static const Hitbox player_sprite_hit_boxes[24] = {
+    { 1, 0, 13, 15 },
+    { 2, 0, 12, 15 },
+    { 3, 1, 11, 14 },
+    { 2, 3, 12, 11 },
+    { 1, 4, 13, 11 },
+    { 0, 3, 15, 12 },
+    { 0, 2, 15, 13 },
+    { 0, 2, 15, 12 },
+    { 1, 2, 14, 11 },
+    { 2, 2, 12, 12 },
+    { 4, 2, 11, 13 },
+    { 3, 1, 12, 15 },
+    { 2, 1, 13, 15 },
+    { 2, 1, 12, 15 },
+    { 2, 1, 11, 14 },
+    { 2, 2, 12, 11 },
+    { 2, 1, 13, 11 },
+    { 1, 1, 15, 12 },
+    { 1, 1, 15, 13 },
+    { 1, 2, 15, 12 },
+    { 1, 3, 14, 11 },
+    { 2, 2, 11, 12 },
+    { 1, 1, 11, 13 },
+    { 1, 0, 12, 15 },
+};
+static const u16 player_sprite_hit_masks[384] = {
+    0x0100, 0x0380, 0x0380, 0x0380, 0x07C0, 0x07C0, 0x0FE0, 0x1FF0, 0x3FF8, 0x7FFC, 0x3FF8, 0x0FE0, 0x0380, 0x07C0, 0x0380, 0x0000,
+    0x0400, 0x0600, 0x0F00, 0x0700, 0x0780, 0x0F80, 0x0FF0, 0x0FF8, 0x1FFC, 0x3FFC, 0x3FF0, 0x3FC0, 0x07C0, 0x01E0, 0x00E0, 0x0000,
+    0x0000, 0x1000, 0x0C00, 0x1E00, 0x0F00, 0x0FE0, 0x0FFC, 0x0FF8, 0x0FF8, 0x1FF0, 0x0FF0, 0x1FE0, 0x1FF0, 0x00F0, 0x00E0, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3800, 0x3E10, 0x1FF8, 0x0FFC, 0x1FF8, 0x0FF8, 0x0FF0, 0x0FF0, 0x0FF8, 0x0FB8, 0x0E30, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7470, 0x7FF8, 0x7FF0, 0x1FF8, 0x1FF0, 0x07FC, 0x0FFC, 0x07FC, 0x07D8, 0x0300, 0x0700, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0060, 0x00F0, 0x65F0, 0xFFF8, 0x7FF4, 0x3FFC, 0x1FFE, 0x07FE, 0x03EC, 0x03E0, 0x01C0, 0x0100, 0x0000,
+    0x0000, 0x0000, 0x0040, 0x00E0, 0x01E0, 0x03F0, 0x0FF4, 0x7FFE, 0xFFFE, 0x7FFE, 0x0FF4, 0x03F0, 0x01E0, 0x00E0, 0x0040, 0x0000,
+    0x0000, 0x0000, 0x00C0, 0x01C0, 0x03E0, 0x03E6, 0x03FE, 0x0FFE, 0x3FFC, 0x7FF8, 0xFFF8, 0x27F0, 0x00F0, 0x0070, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0200, 0x0380, 0x03EC, 0x07FE, 0x07FE, 0x07FE, 0x0FF8, 0x1FF8, 0x3FF8, 0x3FF8, 0x5058, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0200, 0x0798, 0x0FFC, 0x07FC, 0x07F0, 0x07F8, 0x07F8, 0x0FFC, 0x0FFC, 0x1FFC, 0x1D00, 0x3800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0070, 0x0578, 0x0FF8, 0x0FF0, 0x0FF8, 0x07F8, 0x07FE, 0x07FE, 0x0FFA, 0x07A0, 0x0F80, 0x0E00, 0x0E00, 0x0000,
+    0x0000, 0x0060, 0x01F0, 0x02F0, 0x0FE0, 0x1FF8, 0x1FFC, 0x0FFC, 0x07FE, 0x03F8, 0x07E0, 0x03C0, 0x03C0, 0x0780, 0x0700, 0x0200,
+    0x0000, 0x01C0, 0x03E0, 0x01C0, 0x07F0, 0x1FFC, 0x3FFE, 0x1FFC, 0x0FF8, 0x07F0, 0x03E0, 0x03E0, 0x01C0, 0x01C0, 0x01C0, 0x0080,
+    0x0000, 0x0700, 0x0780, 0x03E0, 0x03FC, 0x0FFC, 0x3FFC, 0x3FF8, 0x1FF0, 0x0FF0, 0x01F0, 0x01E0, 0x00E0, 0x00F0, 0x0060, 0x0020,
+    0x0000, 0x0700, 0x0F00, 0x0FF8, 0x07F8, 0x0FF0, 0x0FF8, 0x1FF0, 0x1FF0, 0x3FF0, 0x07F0, 0x00F0, 0x0078, 0x0030, 0x0008, 0x0000,
+    0x0000, 0x0000, 0x0C70, 0x1DF0, 0x1FF0, 0x0FF0, 0x0FF0, 0x1FF0, 0x1FF8, 0x3FF0, 0x1FF8, 0x007C, 0x001C, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00E0, 0x00C0, 0x1BE0, 0x3FE0, 0x3FF0, 0x3FE0, 0x0FF8, 0x1FF8, 0x0FFE, 0x1FFE, 0x0E2E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0080, 0x0380, 0x07C0, 0x37C0, 0x7FE0, 0x7FF8, 0x3FFC, 0x2FFE, 0x1FFF, 0x0FA6, 0x0F00, 0x0600, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0200, 0x0700, 0x0780, 0x0FC0, 0x2FF0, 0x7FFE, 0x7FFF, 0x7FFE, 0x2FF0, 0x0FC0, 0x0780, 0x0700, 0x0200, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0E00, 0x0F00, 0x0FE4, 0x1FFF, 0x1FFE, 0x3FFC, 0x7FF0, 0x7FC0, 0x67C0, 0x07C0, 0x0380, 0x0300, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x1A0A, 0x1FFC, 0x1FFC, 0x1FF8, 0x1FF0, 0x7FE0, 0x7FE0, 0x7FE0, 0x37C0, 0x01C0, 0x0040, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0018, 0x00B8, 0x3FF8, 0x3FF0, 0x3FF0, 0x1FE0, 0x1FE0, 0x0FE0, 0x3FE0, 0x3FF0, 0x19E0, 0x0040, 0x0000, 0x0000,
+    0x0000, 0x0070, 0x0070, 0x01F0, 0x05E0, 0x5FF0, 0x7FE0, 0x7FE0, 0x1FE0, 0x1FF0, 0x0FF0, 0x1FF0, 0x1EA0, 0x0E00, 0x0000, 0x0000,
+    0x0040, 0x00E0, 0x01E0, 0x03C0, 0x03C0, 0x07E0, 0x1FC0, 0x7FE0, 0x3FF0, 0x3FF8, 0x1FF8, 0x07F0, 0x0F40, 0x0F80, 0x0600, 0x0000,
+};
+const SpriteHitboxes player_sprite_hit = { player_sprite_hit_boxes, player_sprite_hit_masks, 24, 16 };
+
+// mine_explode_res "Mine_explode.png": 7 frame(s) of 16x16
+static const Hitbox mine_explode_hit_boxes[7] = {
+    { 4, 4, 6, 8 },
+    { 4, 4, 8, 8 },
+    { 2, 2, 10, 10 },
+    { 2, 2, 10, 10 },
+    { 2, 2, 10, 12 },
+    { 2, 2, 10, 12 },
+    { 2, 2, 10, 12 },
+};
+static const u16 mine_explode_hit_masks[112] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0780, 0x0FC0, 0x0FC0, 0x0FC0, 0x0FC0, 0x07C0, 0x07C0, 0x0780, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0780, 0x0FF0, 0x0FF0, 0x0FF0, 0x0FF0, 0x07F0, 0x07F0, 0x0780, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1F80, 0x3FE0, 0x3FE0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x1FF0, 0x1FF0, 0x1FF0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1F80, 0x3FE0, 0x3FE0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x1FF0, 0x1FF0, 0x1FF0, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3F80, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x07E0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3F80, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x3FF0, 0x07E0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3C80, 0x37F0, 0x3370, 0x3830, 0x3070, 0x3870, 0x2020, 0x1030, 0x3870, 0x3B70, 0x3FF0, 0x07E0, 0x0000, 0x0000,
+};
+const SpriteHitboxes mine_explode_hit = { mine_explode_hit_boxes, mine_explode_hit_masks, 7, 16 };
+
+// bullet_sprite_res "bullet_sprite.png": 1 frame(s) of 8x8
+static const Hitbox bullet_sprite_hit_boxes[1] = {
+    { 3, 3, 2, 2 },
+};
+static const u16 bullet_sprite_hit_masks[8] = {
+    0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000, 0x0000,
+};
+const SpriteHitboxes bullet_sprite_hit = { bullet_sprite_hit_boxes, bullet_sprite_hit_masks, 1, 8 };
+
+// sbullet_sprite_res "sbullet_sprite.png": 1 frame(s) of 8x8
+static const Hitbox sbullet_sprite_hit_boxes[1] = {
+    { 2, 2, 4, 4 },
+};
+static const u16 sbullet_sprite_hit_masks[8] = {
+    0x0000, 0x0000, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x0000, 0x0000,
+};
+const SpriteHitboxes sbullet_sprite_hit = { sbullet_sprite_hit_boxes, sbullet_sprite_hit_masks, 1, 8 };
+
+// ebullet_sprite_res "ebullet_sprite.png": 1 frame(s) of 8x8
+static const Hitbox ebullet_sprite_hit_boxes[1] = {
+    { 3, 3, 2, 2 },
+};
+static const u16 ebullet_sprite_hit_masks[8] = {
+    0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000, 0x0000,
+};
+const SpriteHitboxes ebullet_sprite_hit = { ebullet_sprite_hit_boxes, ebullet_sprite_hit_masks, 1, 8 };
+
+// fighter_sprite_res "fighter_sprite-Sheet.png": 4 frame(s) of 8x8
+static const Hitbox fighter_sprite_hit_boxes[4] = {
+    { 1, 2, 6, 4 },
+    { 0, 0, 8, 8 },
+    { 0, 1, 8, 5 },
+    { 1, 0, 7, 8 },
+};
+static const u16 fighter_sprite_hit_masks[32] = {
+    0x0000, 0x0000, 0x1800, 0x3C00, 0x7E00, 0x1800, 0x0000, 0x0000,
+    0x1800, 0x3C00, 0x7E00, 0x7E00, 0x3C00, 0x7E00, 0x9900, 0x9900,
+    0x0000, 0x1800, 0x3C00, 0xFF00, 0x7E00, 0x1800, 0x0000, 0x0000,
+    0x1C00, 0x3E00, 0x7F00, 0x4900, 0x5D00, 0x6B00, 0x1400, 0x2A00,
+};
+const SpriteHitboxes fighter_sprite_hit = { fighter_sprite_hit_boxes, fighter_sprite_hit_masks, 4, 8 };
+
+// fighter_explode_res "Fighter_explode.png": 7 frame(s) of 8x8
+static const Hitbox fighter_explode_hit_boxes[7] = {
+    { 2, 2, 3, 4 },
+    { 2, 2, 4, 4 },
+    { 1, 1, 5, 5 },
+    { 1, 1, 5, 5 },
+    { 1, 1, 5, 6 },
+    { 1, 1, 5, 6 },
+    { 1, 1, 5, 6 },
+};
+static const u16 fighter_explode_hit_masks[56] = {
+    0x0000, 0x0000, 0x1000, 0x3800, 0x1800, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1000, 0x3C00, 0x1C00, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x3000, 0x7800, 0x7C00, 0x3C00, 0x3400, 0x0000, 0x0000,
+    0x0000, 0x3000, 0x7800, 0x7C00, 0x3C00, 0x3400, 0x0000, 0x0000,
+    0x0000, 0x7000, 0x7C00, 0x7C00, 0x3C00, 0x7C00, 0x1800, 0x0000,
+    0x0000, 0x7000, 0x7C00, 0x6C00, 0x2400, 0x7C00, 0x1800, 0x0000,
+    0x0000, 0x5000, 0x0400, 0x4400, 0x0000, 0x4400, 0x1800, 0x0000,
+};
+const SpriteHitboxes fighter_explode_hit = { fighter_explode_hit_boxes, fighter_explode_hit_masks, 7, 8 };
+
+// space_mine_res "spaceMine-sheet.png": 2 frame(s) of 8x8
+static const Hitbox space_mine_hit_boxes[2] = {
+    { 2, 2, 4, 4 },
+    { 2, 2, 4, 4 },
+};
+static const u16 space_mine_hit_masks[16] = {
+    0x0000, 0x0000, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x0000, 0x0000,
+};
+const SpriteHitboxes space_mine_hit = { space_mine_hit_boxes, space_mine_hit_masks, 2, 8 };
@@ -0,0 +1,32 @@
+// hitbox_table.h - generated by tools/gen_hitboxes.py from resources.res, do not edit
+#ifndef HITBOX_TABLE_H
+#define HITBOX_TABLE_H
+
+// Struct SpriteHitboxes is defined in hitbox.h
+
+extern const SpriteHitboxes player_sprite_hit;
+#define PLAYER_SPRITE_HIT_MIN 0  // Smallest box x/y over all frames
+#define PLAYER_SPRITE_HIT_MAX 16  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes mine_explode_hit;
+#define MINE_EXPLODE_HIT_MIN 2  // Smallest box x/y over all frames
+#define MINE_EXPLODE_HIT_MAX 14  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes bullet_sprite_hit;
+#define BULLET_SPRITE_HIT_MIN 3  // Smallest box x/y over all frames
+#define BULLET_SPRITE_HIT_MAX 5  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes sbullet_sprite_hit;
+#define SBULLET_SPRITE_HIT_MIN 2  // Smallest box x/y over all frames
+#define SBULLET_SPRITE_HIT_MAX 6  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes ebullet_sprite_hit;
+#define EBULLET_SPRITE_HIT_MIN 3  // Smallest box x/y over all frames
+#define EBULLET_SPRITE_HIT_MAX 5  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes fighter_sprite_hit;
+#define FIGHTER_SPRITE_HIT_MIN 0  // Smallest box x/y over all frames
+#define FIGHTER_SPRITE_HIT_MAX 8  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes fighter_explode_hit;
+#define FIGHTER_EXPLODE_HIT_MIN 1  // Smallest box x/y over all frames
+#define FIGHTER_EXPLODE_HIT_MAX 7  // Largest box x + w / y + h over all frames
+extern const SpriteHitboxes space_mine_hit;
+#define SPACE_MINE_HIT_MIN 2  // Smallest box x/y over all frames
+#define SPACE_MINE_HIT_MAX 6  // Largest box x + w / y + h over all frames
+
+#endif // HITBOX_TABLE_H
@@ -14,8 +14,11 @@
 TILESET	player_score_tiles		"Scorebar.png"		NONE
 // TILESET	player_score_red_tiles	"Scorebar_red.png"	NONE
 
-// Image for background
-IMAGE 	starbg 			        "Star_Map.png" 		BEST 
+// Background: tiles + raw tilemap, streamed into BG_B as a larger world (see background.c)
+TILESET star_bg_tiles           "Star_Map.png"      BEST    ALL
+TILEMAP star_bg_map             "Star_Map.png"      star_bg_tiles   NONE    ALL
+
+// Image for title
 IMAGE   title 					"Title_screen.png"	BEST
 
 // Sprite Resources
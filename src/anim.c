@@ -0,0 +1,65 @@
+// anim.c
+#include <genesis.h>
+#include "globals.h"
+#include "anim.h"
+
+// Each running animation is a slot in anims[]; owners keep the slot index and hand the
+// engine the address of their sprite_ptr, so the engine never needs to know the entity.
+
+void initAnims(){
+    for (s16 a = 0; a < ANIM_MAX; a++) {
+        anims[a].def = NULL;
+    }
+}
+
+s16 startAnim(const AnimDef* def, Sprite** sprite, u16 owner){
+    for (s16 a = 0; a < ANIM_MAX; a++) {
+        if (anims[a].def == NULL){
+            anims[a].def    = def;
+            anims[a].sprite = sprite;
+            anims[a].owner  = owner;
+            anims[a].frame  = 0;
+            anims[a].delay  = def->durations[0];
+            SPR_setFrame(*sprite, 0);
+            return a;
+        }
+    }
+    return -1;
+}
+
+void stopAnim(s16 a){
+    if (a >= 0) anims[a].def = NULL;
+}
+
+void updateAnims(){
+    for (s16 a = 0; a < ANIM_MAX; a++) {
+        Anim* n = &anims[a];
+        if (n->def == NULL || --n->delay > 0) continue;
+
+        const AnimDef* def = n->def;
+        u16 frame = n->frame + 1;
+        if (frame >= def->num_frames){
+            if (!def->loop){
+                n->def = NULL;  // Free first: done may start another animation
+                if (def->done) def->done(n->owner);
+                continue;
+            }
+            frame = 0;
+        }
+
+        n->frame = frame;
+        n->delay = def->durations[frame];
+        SPR_setFrame(*n->sprite, frame);
+
+        if (n->delay == ANIM_HOLD){
+            n->def = NULL;      // Stays on this frame
+            if (def->done) def->done(n->owner);
+        }
+    }
+}
+
+void refreshAnims(){
+    for (s16 a = 0; a < ANIM_MAX; a++) {
+        if (anims[a].def && *anims[a].sprite) SPR_setFrame(*anims[a].sprite, anims[a].frame);
+    }
+}
@@ -1,24 +1,135 @@
 // background.c
 #include <genesis.h>
+#include <maths.h>      // For abs
 #include "globals.h"    // For scroll offsets, player_scroll_delta_x/y, map constants
 #include "background.h"
-#include "resources.h" // For bg_far_tiles, bg_near_tiles for numTile
+#include "palette_fx.h"
+#include "world.h"
+#include "resources.h" // For star_bg_tiles, star_bg_map
+
+// --- World Map Streaming ---
+// BG_B holds a 64x32 tile window onto the 128x128 tile world.  Each frame only the
+// newly exposed column(s)/row(s) are queued for DMA; the rest of the plane is reused.
+static u16 stream_col;  // World tile column at the left edge of the loaded window
+static u16 stream_row;  // World tile row at the top edge of the loaded window
+
+// DMA_QUEUE reads these at vblank, so each step in a frame needs its own buffer
+static u16 stream_col_buf[MAP_STREAM_MAX_STEP][PLANE_B_TILES_H];
+static u16 stream_row_buf[MAP_STREAM_MAX_STEP][PLANE_B_TILES_W];
+
+// Look up the tilemap entry for a world tile (wraps at WORLD_TILES)
+static u16 worldTile(u16 wx, u16 wy) {
+    wx &= WORLD_TILES_MASK;
+    wy &= WORLD_TILES_MASK;
+
+    u8 sector = world_sectors[(wy / WORLD_SECTOR_TILES) * WORLD_SECTORS + (wx / WORLD_SECTOR_TILES)];
+    u16 chunk = sector & WORLD_SECTOR_CHUNK_MASK;
+    u16 lx = wx & (WORLD_SECTOR_TILES - 1);
+    u16 ly = wy & (WORLD_SECTOR_TILES - 1);
+    u16 flip = 0;
+
+    if (sector & WORLD_SECTOR_HFLIP){
+        lx = (WORLD_SECTOR_TILES - 1) - lx;
+        flip |= TILE_ATTR_HFLIP_MASK;
+    }
+    if (sector & WORLD_SECTOR_VFLIP){
+        ly = (WORLD_SECTOR_TILES - 1) - ly;
+        flip |= TILE_ATTR_VFLIP_MASK;
+    }
+
+    u16 sx = (chunk % STAR_MAP_CHUNKS_W) * WORLD_SECTOR_TILES + lx;
+    u16 sy = (chunk / STAR_MAP_CHUNKS_W) * WORLD_SECTOR_TILES + ly;
+
+    // Tilemap entries are relative to the tileset, so add the VRAM base (PAL0 is 0)
+    return (star_bg_map.tilemap[sy * star_bg_map.w + sx] ^ flip) + ind;
+}
+
+// Fill one plane column from world column wx, covering the loaded row window
+static void streamColumn(u16 wx, u16* buf, TransferMethod tm) {
+    for (u16 r = 0; r < PLANE_B_TILES_H; r++) {
+        buf[r] = worldTile(wx, stream_row + ((r - stream_row) & (PLANE_B_TILES_H - 1)));
+    }
+    VDP_setTileMapDataColumnFast(BG_B, buf, wx & (PLANE_B_TILES_W - 1), 0, PLANE_B_TILES_H, tm);
+}
+
+// Fill one plane row from world row wy, covering the loaded column window
+static void streamRow(u16 wy, u16* buf, TransferMethod tm) {
+    for (u16 c = 0; c < PLANE_B_TILES_W; c++) {
+        buf[c] = worldTile(stream_col + ((c - stream_col) & (PLANE_B_TILES_W - 1)), wy);
+    }
+    VDP_setTileMapDataRow(BG_B, buf, wy & (PLANE_B_TILES_H - 1), 0, PLANE_B_TILES_W, tm);
+}
+
+// Redraw the whole plane window (init, or a jump larger than MAP_STREAM_MAX_STEP)
+static void drawMapWindow(void) {
+    for (u16 r = 0; r < PLANE_B_TILES_H; r++) {
+        streamRow(stream_row + r, stream_row_buf[0], CPU);
+    }
+}
+
+// Camera tile position from the BG_B scroll values (scroll_b_x runs opposite to the camera)
+static u16 cameraCol(void) { return ((-scroll_b_x) >> 3) & WORLD_TILES_MASK; }
+static u16 cameraRow(void) { return (scroll_b_y >> 3) & WORLD_TILES_MASK; }
+
+// Signed shortest distance between two wrapped world tile coordinates
+static s16 wrapDelta(u16 to, u16 from) {
+    return (s16)((to - from + WORLD_TILES / 2) & WORLD_TILES_MASK) - WORLD_TILES / 2;
+}
+
+static void streamMap(void) {
+    s16 dc = wrapDelta(cameraCol(), stream_col);
+    s16 dr = wrapDelta(cameraRow(), stream_row);
+
+    if (abs(dc) > MAP_STREAM_MAX_STEP || abs(dr) > MAP_STREAM_MAX_STEP){
+        stream_col = cameraCol();
+        stream_row = cameraRow();
+        drawMapWindow();
+        return;
+    }
+
+    // New columns are drawn against the old row window; any new rows are then
+    // written full-width against the new column window, so the plane stays consistent.
+    for (s16 s = 0; s < abs(dc); s++) {
+        if (dc > 0){
+            stream_col = (stream_col + 1) & WORLD_TILES_MASK;
+            streamColumn(stream_col + PLANE_B_TILES_W - 1, stream_col_buf[s], DMA_QUEUE);
+        } else {
+            stream_col = (stream_col - 1) & WORLD_TILES_MASK;
+            streamColumn(stream_col, stream_col_buf[s], DMA_QUEUE);
+        }
+    }
+
+    for (s16 s = 0; s < abs(dr); s++) {
+        if (dr > 0){
+            stream_row = (stream_row + 1) & WORLD_TILES_MASK;
+            streamRow(stream_row + PLANE_B_TILES_H - 1, stream_row_buf[s], DMA_QUEUE);
+        } else {
+            stream_row = (stream_row - 1) & WORLD_TILES_MASK;
+            streamRow(stream_row, stream_row_buf[s], DMA_QUEUE);
+        }
+    }
+}
 
 void initBackground(void) {
 
     // Initial scroll positions
     scroll_a_x = 0; scroll_a_y = 0;
     scroll_b_x = 0; scroll_b_y = 0;
+    initCamera();
 
     // VDP_loadTileSet(&star_bg_tiles, ind, DMA_QUEUE);
     // star_map = MAP_create(&star_bg_map, BG_B, TILE_ATTR_FULL(PAL0, FALSE, FALSE, FALSE, ind));
     // PAL_setPalette(PAL0, star_bg_pal.data, DMA_QUEUE);
     // MAP_scrollTo(star_map, scroll_b_x, scroll_b_y);
 
-    // New background
-    PAL_setPalette(PAL0, star_bg_pal.data, DMA_QUEUE);
-    VDP_drawImageEx(BG_B, &starbg, TILE_ATTR_FULL(PAL0, FALSE, FALSE, FALSE, ind), 0, 0, FALSE, TRUE);
-    ind_sc = ind + starbg.tileset -> numTile;
+    // New background: tiles once, then the world window is streamed
+    setPaletteFx(PAL0, star_bg_pal.data);
+    VDP_loadTileSet(&star_bg_tiles, ind, DMA);
+    ind_sc = ind + star_bg_tiles.numTile;
+
+    stream_col = cameraCol();
+    stream_row = cameraRow();
+    drawMapWindow();
 }
 
 // --- Update Scrolling Function ---
@@ -32,10 +143,14 @@ void updateScrolling() {
     // Parallax for far layer (Plane B)
     scroll_b_x -= (player_scroll_delta_x / PARALLAX_FACTOR_BG_B) % 512; // Or use PARALLAX_FACTOR_BG_B as per defines
     scroll_b_y += (player_scroll_delta_y / PARALLAX_FACTOR_BG_B) % 256; // Assuming A is near, B is far from defines
+}
 
+// Once per rendered frame, however many simulation ticks moved the camera
+void drawScrolling() {
+    streamMap(); // Queue any newly exposed world column/row
 
     // VDP_setHorizontalScroll(BG_A, scroll_a_x);
     // VDP_setVerticalScroll(BG_A, scroll_a_y);
     VDP_setHorizontalScroll(BG_B, scroll_b_x);
     VDP_setVerticalScroll(BG_B, scroll_b_y);
-}
\ No newline at end of file
+}
@@ -0,0 +1,81 @@
+// bullet_pool.c
+#include <genesis.h>
+#include "globals.h"
+#include "bullet_pool.h"
+
+void initBulletPool(BulletPool* pool, Bullet* items, u16 size){
+    pool->items      = items;
+    pool->size       = size;
+    pool->capacity   = size;
+    pool->live_count = 0;
+    pool->live_head  = -1;
+    pool->free_head  = 0;
+
+    for (s16 i = 0; i < size; i++) {
+        items[i].status     = -1; // Inactive
+        items[i].new_bullet = 0;
+        items[i].sprite_ptr = NULL;
+        items[i].bvxrem     = 0;
+        items[i].bvyrem     = 0;
+        items[i].prev       = -1;
+        items[i].next       = (i + 1 < size) ? i + 1 : -1;
+    }
+}
+
+s16 allocBullet(BulletPool* pool){
+    if (pool->live_count >= pool->capacity || pool->free_head < 0) return -1;
+
+    Bullet* items = pool->items;
+    s16 i = pool->free_head;
+    pool->free_head = items[i].next;
+
+    // Push onto the front of the live list
+    items[i].prev = -1;
+    items[i].next = pool->live_head;
+    if (pool->live_head >= 0) items[pool->live_head].prev = i;
+    pool->live_head = i;
+    pool->live_count += 1;
+
+    items[i].new_bullet = 0;
+    items[i].bvxrem = 0;
+    items[i].bvyrem = 0;
+    return i;
+}
+
+void freeBullet(BulletPool* pool, s16 i){
+    Bullet* items = pool->items;
+
+    items[i].status = -1; // Deactivate
+    if (items[i].sprite_ptr) SPR_releaseSprite(items[i].sprite_ptr);
+    items[i].sprite_ptr = NULL;
+
+    // Unlink from the live list
+    if (items[i].prev >= 0) items[items[i].prev].next = items[i].next;
+    else pool->live_head = items[i].next;
+    if (items[i].next >= 0) items[items[i].next].prev = items[i].prev;
+
+    items[i].next = pool->free_head;
+    pool->free_head = i;
+    pool->live_count -= 1;
+}
+
+void clearBulletPool(BulletPool* pool){
+    while (pool->live_head >= 0){
+        freeBullet(pool, pool->live_head);
+    }
+}
+
+static u16 clampCapacity(u16 capacity, u16 size){
+    return (capacity > size) ? size : capacity;
+}
+
+void applyLevelPoolSizes(){
+    u16 l = game_level ? game_level - 1 : 0;
+    if (l >= POOL_SIZE_LEVELS) l = POOL_SIZE_LEVELS - 1;
+
+    // Shrinking only limits new allocations; bullets already in flight finish normally
+    bullet_pool.capacity  = clampCapacity(level_pool_sizes[l].bullets,  bullet_pool.size);
+    ebullet_pool.capacity = clampCapacity(level_pool_sizes[l].ebullets, ebullet_pool.size);
+    sbullet_pool.capacity = clampCapacity(level_pool_sizes[l].sbullets, sbullet_pool.size);
+    mine_cap              = clampCapacity(level_pool_sizes[l].mines,    NMINE_MAX);
+}
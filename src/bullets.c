@@ -2,40 +2,33 @@
 #include <genesis.h>
 #include "globals.h" // For Bullet struct, bullets array, player_x/y, sin_fix, cos_fix, screen_width_pixels, etc.
 #include "bullets.h"
+#include "bullet_pool.h"
+#include "game_events.h"
+#include "collision.h"
+#include "sfx.h"
+#include "input.h"
+#include "sprite_atlas.h"
 #include "resources.h" // For bullet_sprite_res
 // #include "fighters.h" // Not directly, globals.h has fighters array for collision
 
 // --- Initialize Bullet Pool ---
 void initBullets() {
-    for (s16 i = 0; i < NBULLET; i++) {
-        bullets[i].status       = -1; // Inactive
-        bullets[i].new_bullet   = 0;
-        bullets[i].sprite_ptr   = NULL;
-        bullets[i].bvxrem       = 0;
-        bullets[i].bvyrem       = 0;
-    }
-    current_bullet_index = 0;
+    initBulletPool(&bullet_pool, bullets, NBULLET);
     new_bullet_delay_timer = 0; // Already in player.c, maybe move shared timer to globals
 }
 
 void fireBullet(){
     if (new_bullet_delay_timer > NBULLET_TIMER_MAX){ // This timer is incremented in handleInput
         new_bullet_delay_timer = 0;
-        if (bullets[current_bullet_index].status < 0){ // Check if current slot is available
-            bullets[current_bullet_index].status = player_rotation_index; // Store direction
-            bullets[current_bullet_index].new_bullet = 1;
-            bullets[current_bullet_index].x = player_x + 4; // Offset from player center
-            bullets[current_bullet_index].y = player_y + 4;
-            bullets[current_bullet_index].bvxrem = 0;
-            bullets[current_bullet_index].bvyrem = 0;
+        s16 b = allocBullet(&bullet_pool); // Any free slot, -1 only when the pool is at capacity
+        if (b >= 0){
+            bullets[b].status = player_rotation_index; // Store direction
+            bullets[b].new_bullet = 1;
+            bullets[b].x = player_x + 4; // Offset from player center
+            bullets[b].y = player_y + 4;
 
-            current_bullet_index++;
-            if (current_bullet_index >= NBULLET){
-                current_bullet_index = 0;
-            }
             // priority 0 is the lowest 
-            // XGM_startPlayPCM(SFX_LASER, 1, SOUND_PCM_CH2); //name, priority (0-15), channel (2-4) 
-            XGM2_playPCMEx(sfx_laser, sizeof(sfx_laser), SOUND_PCM_CH2, 2, FALSE, FALSE);
+            playSfx(SFX_LASER);
         }
     }
 }
@@ -45,56 +38,51 @@ void updateBullets()
     s16 bvx_req, bvy_req;       // Requested velocity per bullet
     s16 bvx_applied, bvy_applied; // Applied velocity (after remainder)
 
-    for (s16 i = 0; i < NBULLET; i++) {
+    s16 next;
+    for (s16 i = bullet_pool.live_head; i >= 0; i = next) { // Live bullets only
+        next = bullets[i].next; // Saved before a free relinks this entry
         if (bullets[i].status >= 0) { // If bullet is active
             if (bullets[i].new_bullet > 0){
-                bullets[i].sprite_ptr = SPR_addSprite(&bullet_sprite_res,
+                bullets[i].sprite_ptr = addAtlasSprite(&bullet_sprite_res,
                                                 bullets[i].x,
                                                 bullets[i].y,
                                                 TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
                 bullets[i].new_bullet = 0;
+                inputResponse(BUTTON_B); // Shot is on screen from this vblank
             }
 
-            // Collision with fighters
+            // Step for this frame
+            bvx_req = -sin_fix[bullets[i].status]; // Using stored direction
+            bvy_req = -cos_fix[bullets[i].status];
+
+            // Speed adjustment (>>6 means divide by 64, so sin/cos are scaled up)
+            // Original code implies sin_fix/cos_fix are scaled by 255.
+            // For a speed of 4 pixels/frame, 255 / 64 is approx 4.
+            bvx_applied = ( (bvx_req + bullets[i].bvxrem) >> 6);
+            bvy_applied = ( (bvy_req + bullets[i].bvyrem) >> 6);
+
+            // Motion relative to the fighters, which will scroll by -player_scroll_delta this frame
+            s16 rdx = bvx_applied + player_scroll_delta_x;
+            s16 rdy = bvy_applied + player_scroll_delta_y;
+
+            // Collision with fighters, swept over this frame's step so boosting can't tunnel
             for (s16 f = 0; f < active_fighter_count; f++) {
                 if (fighters[f].status >= 0){ // If fighter is active
-                    // Simple AABB collision check (8x8 sprite assumed for fighter, 4x4 for bullet, adjust as needed)
-                    if (fighters[f].x     < bullets[i].x + 2 && // fighter left < bullet right
-                        fighters[f].x + 8 > bullets[i].x     && // fighter right > bullet left
-                        fighters[f].y     < bullets[i].y + 2 && // fighter top < bullet bottom
-                        fighters[f].y + 8 > bullets[i].y)       // fighter bottom > bullet top
+                    if (spriteSweptHit(&bullet_sprite_hit, 0, bullets[i].x, bullets[i].y, rdx, rdy,
+                                       &fighter_sprite_hit, FIGHTER_FRAME, fighters[f].x, fighters[f].y))
                     {
-                        bullets[i].status = -1; // Deactivate bullet
-                        if(bullets[i].sprite_ptr) SPR_releaseSprite(bullets[i].sprite_ptr);
-                        bullets[i].sprite_ptr = NULL;
+                        freeBullet(&bullet_pool, i); // Deactivate bullet
 
                         fighters[f].status = -9; // Deactivate fighter (-9 means we do an explosion)
-                        if(fighters[f].sprite_ptr) SPR_releaseSprite(fighters[f].sprite_ptr);
-                        fighters[f].sprite_ptr = NULL;
-                        XGM2_playPCMEx(sfx_explode, sizeof(sfx_explode), SOUND_PCM_CH3, 4, FALSE, FALSE);
+                        pushGameEvent(EVT_KILL, CAUSE_BULLET, f, -1); // Score, sound and sprite release
 
-                        player_score += 1;
-                        game_score +=3;
-                        
-                        // Potentially add explosion, score, sound effect here
                         break; // Bullet can only hit one fighter per frame
                     }
                 }
             }
-             // If bullet still active after collision checks
-            if (bullets[i].status >= 0) {
-
-                // bullets[i].x += -player_scroll_delta_x; // Adjust for map scroll
-                // bullets[i].y += -player_scroll_delta_y; // Adjust for map scroll
 
-                bvx_req = -sin_fix[bullets[i].status]; // Using stored direction
-                bvy_req = -cos_fix[bullets[i].status];
-
-                // Speed adjustment (>>6 means divide by 64, so sin/cos are scaled up)
-                // Original code implies sin_fix/cos_fix are scaled by 255.
-                // For a speed of 4 pixels/frame, 255 / 64 is approx 4.
-                bvx_applied = ( (bvx_req + bullets[i].bvxrem) >> 6);
-                bvy_applied = ( (bvy_req + bullets[i].bvyrem) >> 6);
+            // If bullet still active after collision checks
+            if (bullets[i].status >= 0) {
                 bullets[i].bvxrem  = bvx_req + bullets[i].bvxrem - bvx_applied * 64;
                 bullets[i].bvyrem  = bvy_req + bullets[i].bvyrem - bvy_applied * 64;
                 bullets[i].x += bvx_applied;
@@ -105,9 +93,7 @@ void updateBullets()
                     bullets[i].y > 0 && bullets[i].y < screen_height_pixels) {
                     if(bullets[i].sprite_ptr) SPR_setPosition(bullets[i].sprite_ptr, bullets[i].x, bullets[i].y);
                 } else {
-                    bullets[i].status = -1; // Deactivate
-                    if(bullets[i].sprite_ptr) SPR_releaseSprite(bullets[i].sprite_ptr);
-                    bullets[i].sprite_ptr = NULL;
+                    freeBullet(&bullet_pool, i); // Deactivate
                 }
             }
         }
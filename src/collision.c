@@ -0,0 +1,95 @@
+// collision.c
+#include <genesis.h>
+#include <maths.h>   // For abs
+#include "collision.h"
+
+// Entry/exit times along the segment are kept as fractions num/den with den > 0,
+// compared by cross-multiplying.  Terms stay s16 so the products are single muls.w.
+typedef struct {
+    s16 num;
+    s16 den;
+} SweepTime;
+
+#define timeLess(a, b)  ((s32)(a).num * (b).den < (s32)(b).num * (a).den)
+
+// Clip [enter, exit] against one axis: point p moving by d must stay inside the open slab (lo, hi)
+static u16 clipSlab(s16 p, s16 d, s16 lo, s16 hi, SweepTime* enter, SweepTime* exit){
+    if (d == 0) return p > lo && p < hi; // Not moving on this axis: inside the slab or never
+
+    SweepTime t_in, t_out;
+    if (d > 0){
+        t_in.num  = lo - p;  t_out.num = hi - p;
+        t_in.den  = d;       t_out.den = d;
+    } else {
+        t_in.num  = p - hi;  t_out.num = p - lo;
+        t_in.den  = -d;      t_out.den = -d;
+    }
+
+    if (timeLess(*enter, t_in)) *enter = t_in;
+    if (timeLess(t_out, *exit)) *exit  = t_out;
+    return TRUE;
+}
+
+u16 sweptBoxHit(s16 ax, s16 ay, s16 aw, s16 ah, s16 dx, s16 dy,
+                s16 bx, s16 by, s16 bw, s16 bh){
+
+    if (!isFastMover(dx, dy, aw, ah)){
+        return boxOverlap(ax + dx, ay + dy, aw, ah, bx, by, bw, bh);
+    }
+
+    // Broad phase: the box covering the whole move
+    s16 sx = (dx < 0) ? ax + dx : ax;
+    s16 sy = (dy < 0) ? ay + dy : ay;
+    if (!boxOverlap(sx, sy, aw + abs(dx), ah + abs(dy), bx, by, bw, bh)) return FALSE;
+
+    // Narrow phase: a's top-left corner against b grown by a's size, over t in [0, 1]
+    SweepTime enter = { 0, 1 };
+    SweepTime exit  = { 1, 1 };
+    if (!clipSlab(ax, dx, bx - aw, bx + bw, &enter, &exit)) return FALSE;
+    if (!clipSlab(ay, dy, by - ah, by + bh, &enter, &exit)) return FALSE;
+
+    return timeLess(enter, exit);
+}
+
+// Pixel test for two frames whose tight boxes overlap.  Sprites are at most 16 px wide
+// when they have masks, so the horizontal offset always fits a 32-bit shift.
+static u16 maskHit(const SpriteHitboxes* a, u16 fa, s16 ax, s16 ay,
+                   const SpriteHitboxes* b, u16 fb, s16 bx, s16 by){
+    if (a->masks == NULL || b->masks == NULL) return TRUE; // No mask: the box hit stands
+
+    s16 y1 = (ay > by) ? ay : by;
+    s16 y2 = (ay + a->mask_rows < by + b->mask_rows) ? ay + a->mask_rows : by + b->mask_rows;
+    s16 shift = bx - ax;
+    const u16* ma = &a->masks[fa * a->mask_rows + (y1 - ay)];
+    const u16* mb = &b->masks[fb * b->mask_rows + (y1 - by)];
+
+    for (s16 y = y1; y < y2; y++) {
+        u32 ra = (u32)*ma++ << 16;
+        u32 rb = (u32)*mb++ << 16;
+        if (shift >= 0) rb >>= shift;
+        else            ra >>= -shift;
+        if (ra & rb) return TRUE;
+    }
+    return FALSE;
+}
+
+u16 spriteHit(const SpriteHitboxes* a, u16 fa, s16 ax, s16 ay,
+              const SpriteHitboxes* b, u16 fb, s16 bx, s16 by){
+    const Hitbox* ha = &a->boxes[fa];
+    const Hitbox* hb = &b->boxes[fb];
+
+    if (!boxOverlap(ax + ha->x, ay + ha->y, ha->w, ha->h, bx + hb->x, by + hb->y, hb->w, hb->h)) return FALSE;
+    return maskHit(a, fa, ax, ay, b, fb, bx, by);
+}
+
+u16 spriteSweptHit(const SpriteHitboxes* a, u16 fa, s16 ax, s16 ay, s16 dx, s16 dy,
+                   const SpriteHitboxes* b, u16 fb, s16 bx, s16 by){
+    const Hitbox* ha = &a->boxes[fa];
+    const Hitbox* hb = &b->boxes[fb];
+
+    if (!isFastMover(dx, dy, ha->w, ha->h)){
+        return spriteHit(a, fa, ax + dx, ay + dy, b, fb, bx, by);
+    }
+    return sweptBoxHit(ax + ha->x, ay + ha->y, ha->w, ha->h, dx, dy,
+                       bx + hb->x, by + hb->y, hb->w, hb->h);
+}
@@ -0,0 +1,91 @@
+// controls.c
+#include <genesis.h>
+#include "globals.h"    // For player variables, sin_fix, cos_fix
+#include "controls.h"
+
+// Directional styles: the dpad bits index the heading and thrust straight away.
+// Opposite directions resolve as before: up beats down, left beats right.
+static const DpadVector dpad_vectors[16] = {
+    { -1,    0,    0 },  // none
+    {  0,    0, -127 },  // U
+    { 12,    0,  127 },  // D
+    {  0,    0, -127 },  // U D
+    {  6, -127,    0 },  // L
+    {  3,  -90,  -90 },  // U L
+    {  9,  -90,   90 },  // D L
+    {  3,  -90,  -90 },  // U D L
+    { 18,  127,    0 },  // R
+    { 21,   90,  -90 },  // U R
+    { 15,   90,   90 },  // D R
+    { 21,   90,  -90 },  // U D R
+    {  6, -127,    0 },  // L R
+    {  3,  -90,  -90 },  // U L R
+    {  9,  -90,   90 },  // D L R
+    {  3,  -90,  -90 },  // U D L R
+};
+
+// Rotational style: turn direction (+1 left, -1 right) and thrust (+1 forward, -1 reverse) per dpad mask
+static const s8 dpad_turn[16]   = { 0, 0, 0, 0, 1, 1, 1, 1, -1, -1, -1, -1, 1, 1, 1, 1 };
+static const s8 dpad_thrust[16] = { 0, 1, -1, 1, 0, 1, -1, 1, 0, 1, -1, 1, 0, 1, -1, 1 };
+
+static void steerRotate(u16 value){
+    u16 pad = value & DPAD_MASK;
+
+    // --- Rotation ---
+    if (player_rotation_iframe >= player_rotation_iframe_threshold){
+        player_rotation_iframe = 0;
+
+        player_rotation_index += dpad_turn[pad];
+        if (player_rotation_index > player_rotation_index_max) player_rotation_index = 0;
+        if (player_rotation_index < 0) player_rotation_index = player_rotation_index_max;
+    }
+    player_rotation_iframe += 1;
+
+    // --- Thrust ---
+    player_vx = 0; // Default is no thrust applied.
+    player_vy = 0;
+    if (dpad_thrust[pad] > 0) {
+        player_vx = -sin_fix[player_rotation_index];
+        player_vy = -cos_fix[player_rotation_index];
+        player_thrust_delay_timer = 0;
+    } else if (dpad_thrust[pad] < 0) {
+        player_vx =  sin_fix_d2[player_rotation_index];
+        player_vy =  cos_fix_d2[player_rotation_index];
+        player_thrust_delay_timer = 0;
+    }
+}
+
+static void steerDirect(u16 value){
+    const DpadVector* d = &dpad_vectors[value & DPAD_MASK];
+
+    player_vx = d->vx; // Zero when released
+    player_vy = d->vy;
+    if (d->rotation_index >= 0){
+        player_rotation_index = d->rotation_index;
+        player_thrust_delay_timer = 0;
+    }
+}
+
+static void steerStrafe(u16 value){
+    const DpadVector* d = &dpad_vectors[value & DPAD_MASK];
+
+    player_vx = d->vx;
+    player_vy = d->vy;
+    if (d->rotation_index >= 0){
+        if (!(value & BUTTON_Z)) player_rotation_index = d->rotation_index; // Z holds the facing
+        player_thrust_delay_timer = 0;
+    }
+}
+
+const ControlStyle control_styles[CONTROL_STYLE_COUNT] = {
+    [CONTROL_ROTATE] = { "Control R", 5, steerRotate },
+    [CONTROL_DIRECT] = { "Control D", 2, steerDirect },
+    [CONTROL_STRAFE] = { "Control S", 2, steerStrafe },
+};
+
+void (*steerPlayer)(u16 value) = steerDirect; // control_style starts at CONTROL_DIRECT
+
+void bindControlStyle(s16 style){
+    steerPlayer  = control_styles[style].steer;
+    boost_factor = control_styles[style].boost_factor;
+}
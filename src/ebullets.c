@@ -3,91 +3,119 @@
 #include <maths.h>   // For ABS
 #include "globals.h" // For Bullet struct, bullets array, player_x/y, sin_fix, cos_fix, screen_width_pixels, etc.
 #include "ebullets.h"
+#include "bullet_pool.h"
+#include "game_events.h"
+#include "sfx.h"
+#include "visibility.h"
+#include "collision.h"
+#include "sprite_atlas.h"
 #include "resources.h" // For bullet_sprite_res
 // #include "fighters.h" // Not directly, globals.h has fighters array for collision
 
 
 #define ENEMY_BULLET_SPEED  4 
 
+// Fighters whose cooldown has run out, oldest first.  A fighter is queued at most once:
+// it enters when its cooldown reaches 0 and leaves when it fires.
+static u8 ready_queue[NFIGHTER_MAX];
+static u16 ready_count = 0;
+
 void init_eBullets(){
-	for (s16 i = 0; i < NEBULLET; i++) {
-        ebullets[i].status       = -1; // Inactive
-        ebullets[i].new_bullet   = 0;
-        ebullets[i].sprite_ptr   = NULL;
-        ebullets[i].bvxrem       = 0;
-        ebullets[i].bvyrem       = 0;
-    }
-    current_ebullet_index = 0;
+	initBulletPool(&ebullet_pool, ebullets, NEBULLET);
     new_ebullet_delay_timer = 2; // Already in player.c, maybe move shared timer to globals
 }
 
+void initFighterFire(){
+	ready_count = 0;
+	for (s16 i = 0; i < active_fighter_count; i++) {
+		fighter_cooldown[i] = 0;
+		ready_queue[ready_count++] = i;
+	}
+}
+
+// After a snapshot restore: queue every fighter whose cooldown has run out, in index order
+void rebuildFighterFire(){
+	ready_count = 0;
+	for (s16 i = 0; i < active_fighter_count; i++) {
+		if (fighter_cooldown[i] == 0) ready_queue[ready_count++] = i;
+	}
+}
+
+void tickFighterCooldowns(){
+	// Runs every frame regardless of pool state, so the fire rate only depends on efire_cooldown_timer
+	for (s16 i = 0; i < active_fighter_count; i++) {
+		if (fighter_cooldown[i] > 0){
+			fighter_cooldown[i] -= 1;
+			if (fighter_cooldown[i] == 0) ready_queue[ready_count++] = i;
+		}
+	}
+}
+
+static void unqueueReady(u16 k){
+	ready_count -= 1;
+	for (; k < ready_count; k++) {
+		ready_queue[k] = ready_queue[k + 1];
+	}
+}
+
 void fire_eBullet(){
 
+	tickFighterCooldowns();
+
 	if (new_ebullet_delay_timer > NEBULLET_TIMER_MAX){ // This timer is incremented in handleInput
         new_ebullet_delay_timer = 0;
-        if (ebullets[current_ebullet_index].status < 0){
-
-        	// Now we loop through fighters to see if one is in position to fire.
-        	for (s16 i = 0; i < active_fighter_count; i++) {
-        		if (fighters[i].status == 1) {
-
-        			if (fighters[i].x > -8 && fighters[i].x < screen_width_pixels && // Allow slightly offscreen for smooth entry
-                    fighters[i].y > -8 && fighters[i].y < screen_height_pixels) {
+        if (bulletPoolFree(&ebullet_pool) > 0){ // Any free slot
 
-                    	s16 fdx =  player_x - fighters[i].x;
-            			s16 fdy = -player_y + fighters[i].y; // May need to flip this one
-            			s16 distance = abs(fdx) + abs(fdy); // Rough distance
+        	// Only ready fighters are considered, and only on-screen ones are in position to fire
+        	for (u16 k = 0; k < ready_count; k++) {
+        		s16 i = ready_queue[k];
+        		if (fighters[i].status >= 0 && VIS_TEST(fighter_visible, i)) {
 
-            			if (distance > 0){
+                	s16 fdx =  player_x - fighters[i].x;
+        			s16 fdy = -player_y + fighters[i].y; // May need to flip this one
+        			s16 distance = abs(fdx) + abs(fdy); // Rough distance
 
-            				s16 tti_frames = distance / ENEMY_BULLET_SPEED;
-        					if (tti_frames == 0 && distance > 0) tti_frames = 1; // Min 1 frame prediction if close
+        			if (distance > 0){
 
-        					s16 pre_player_x = player_x + 4 + (player_vx_applied * tti_frames);
-        					s16 pre_player_y = player_y + 4 + (player_vy_applied * tti_frames); // Screen Y
+        				s16 tti_frames = distance / ENEMY_BULLET_SPEED;
+    					if (tti_frames == 0 && distance > 0) tti_frames = 1; // Min 1 frame prediction if close
 
-        					// Update target deltas to this predicted position
-					        fdx =  pre_player_x - fighters[i].x;
-					        fdy = -pre_player_y + fighters[i].y;
+    					s16 pre_player_x = player_x + 4 + (player_vx_applied * tti_frames);
+    					s16 pre_player_y = player_y + 4 + (player_vy_applied * tti_frames); // Screen Y
 
-					        s16 best_index = 0;
-					        s32 max_dot = -32768 * 256; // Smallest possible s32 (approx)
-					        for (s16 j = 0; j < SINCOS_TABLE_STEPS; ++j) {
-					        	s32 current_dot = (s32)fdx * cos_fix[j] + (s32)fdy * sin_fix[j];
-					        	if (current_dot > max_dot) {
-						            max_dot = current_dot;
-						            best_index = j;
-						        }
+    					// Update target deltas to this predicted position
+				        fdx =  pre_player_x - fighters[i].x;
+				        fdy = -pre_player_y + fighters[i].y;
 
-					        } 
+				        s16 best_index = 0;
+				        s32 max_dot = -32768 * 256; // Smallest possible s32 (approx)
+				        for (s16 j = 0; j < SINCOS_TABLE_STEPS; ++j) {
+				        	s32 current_dot = (s32)fdx * cos_fix[j] + (s32)fdy * sin_fix[j];
+				        	if (current_dot > max_dot) {
+					            max_dot = current_dot;
+					            best_index = j;
+					        }
 
-					        ebullets[current_ebullet_index].status       = best_index;
-					        ebullets[current_ebullet_index].new_bullet   = 1;
-					        ebullets[current_ebullet_index].x 			 = fighters[i].x;
-					        ebullets[current_ebullet_index].y 			 = fighters[i].y;
+				        } 
 
-            				XGM2_playPCMEx(sfx_elaser, sizeof(sfx_elaser), SOUND_PCM_CH3, 1, TRUE, FALSE);
-        					fighters[i].status += 1;
+				        s16 b = allocBullet(&ebullet_pool);
+				        ebullets[b].status       = best_index;
+				        ebullets[b].new_bullet   = 1;
+				        ebullets[b].x 			 = fighters[i].x;
+				        ebullets[b].y 			 = fighters[i].y;
 
-        					break;
+        				playSfx(SFX_ELASER);
 
-            			}
+        				// here is the delay for the next bullet to be fired.
+        				fighter_cooldown[i] = (efire_cooldown_timer - 1) * EFIRE_WINDOW_FRAMES;
+        				unqueueReady(k);
 
-        			}
+    					break;
 
-        		} else if (fighters[i].status > 1){
-        			fighters[i].status += 1;
-        			if (fighters[i].status > efire_cooldown_timer){  // here is the delay for the next bullet to be fired.  
-        				fighters[i].status = 1; // Ready to fire again.
         			}
 
         		}
         	}
-
-        	current_ebullet_index++;
-            if (current_ebullet_index >= NEBULLET){
-                current_ebullet_index = 0;  // Reset enemy bullet timer
-            }
         }
     }
 
@@ -98,10 +126,12 @@ void update_eBullets(){
 	s16 bvx_req, bvy_req;       // Requested velocity per bullet
     s16 bvx_applied, bvy_applied; // Applied velocity (after remainder)
 
-    for (s16 i = 0; i < NEBULLET; i++) {
+    s16 next;
+    for (s16 i = ebullet_pool.live_head; i >= 0; i = next) { // Live bullets only
+        next = ebullets[i].next; // Saved before a free relinks this entry
         if (ebullets[i].status >= 0) { // If bullet is active
             if (ebullets[i].new_bullet > 0){
-                ebullets[i].sprite_ptr = SPR_addSprite(&ebullet_sprite_res,
+                ebullets[i].sprite_ptr = addAtlasSprite(&ebullet_sprite_res,
                                                 ebullets[i].x,
                                                 ebullets[i].y,
                                                 TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
@@ -109,22 +139,12 @@ void update_eBullets(){
             }
 
             // Collision with Player
-            if (player_x      < ebullets[i].x + 2 && // fighter left < bullet right
-                player_x + 16 > ebullets[i].x     && // fighter right > bullet left
-                player_y      < ebullets[i].y + 2 && // fighter top < bullet bottom
-                player_y + 16 > ebullets[i].y)       // fighter bottom > bullet top
+            if (spriteHit(&ebullet_sprite_hit, 0, ebullets[i].x, ebullets[i].y,
+                          &player_sprite_hit, player_rotation_index, player_x, player_y))
             {
-                ebullets[i].status = -1; // Deactivate bullet
-                if(ebullets[i].sprite_ptr) SPR_releaseSprite(ebullets[i].sprite_ptr);
-                ebullets[i].sprite_ptr = NULL;
-
-                XGM2_playPCMEx(sfx_explode, sizeof(sfx_explode), SOUND_PCM_CH2, 4, TRUE, FALSE);
+                freeBullet(&ebullet_pool, i); // Deactivate bullet
 
-                if (shield_status < 0){  // Check shield status
-                	fighters_score += 1; // Score one for the bad guys
-                }
-                               
-                // Potentially add explosion, score, sound effect here
+                pushGameEvent(EVT_PLAYER_HIT, CAUSE_EBULLET, -1, -1); // Scores for the bad guys if the shield is down
             }
 
 
@@ -154,9 +174,7 @@ void update_eBullets(){
 	                ebullets[i].y > 0 && ebullets[i].y < screen_height_pixels) {
 	                if(ebullets[i].sprite_ptr) SPR_setPosition(ebullets[i].sprite_ptr, ebullets[i].x, ebullets[i].y);
 	            } else {
-	                ebullets[i].status = -1; // Deactivate
-	                if(ebullets[i].sprite_ptr) SPR_releaseSprite(ebullets[i].sprite_ptr);
-	                ebullets[i].sprite_ptr = NULL;
+	                freeBullet(&ebullet_pool, i); // Deactivate
 	            }
 	        }
         }
@@ -0,0 +1,104 @@
+// explosions.c
+#include <genesis.h>
+#include "globals.h" // For Explosion struct, explosions array, player_scroll_delta_x/y, screen size
+#include "explosions.h"
+#include "visibility.h"
+#include "anim.h"
+#include "sprite_atlas.h"
+#include "resources.h" // For fighter_explode_res, mine_explode_res
+
+typedef struct {
+    const SpriteDefinition* sprite_def;
+    const AnimDef* anim;
+    s16 size;       // Sprite size in pixels, for the on-screen test
+} ExplosionKind;
+
+static void freeExplosion(u16 i);
+
+// Game frames per explosion frame (both sheets have 7)
+static const u8 explode_durations[7] = { 5, 5, 5, 5, 5, 5, 5 };
+static const AnimDef explode_anim = { explode_durations, 7, FALSE, freeExplosion };
+
+static const ExplosionKind explosion_kinds[] = {
+    [EXPLOSION_FIGHTER] = { &fighter_explode_res, &explode_anim, 8  },
+    [EXPLOSION_MINE]    = { &mine_explode_res,    &explode_anim, 16 },
+};
+
+void initExplosions(){
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        explosions[i].anim = -1; // Free
+        explosions[i].sprite_ptr = NULL;
+    }
+}
+
+s16 spawnExplosion(u16 kind, s16 x, s16 y){
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        if (explosions[i].anim < 0){
+            explosions[i].sprite_ptr = addAtlasSprite(explosion_kinds[kind].sprite_def,
+                                                x, y, TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
+            explosions[i].anim = startAnim(explosion_kinds[kind].anim, &explosions[i].sprite_ptr, i);
+            if (explosions[i].anim < 0){
+                freeExplosion(i); // No animation slot: skip the effect
+                return -1;
+            }
+            explosions[i].kind  = kind;
+            explosions[i].x     = x;
+            explosions[i].y     = y;
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Animation done (or cleared): release the sprite and the slot
+static void freeExplosion(u16 i){
+    if (explosions[i].sprite_ptr) SPR_releaseSprite(explosions[i].sprite_ptr);
+    explosions[i].sprite_ptr = NULL;
+    explosions[i].anim = -1;
+}
+
+// Frames are advanced by updateAnims; this only keeps explosions on the scrolling map
+void updateExplosions(){
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        if (explosions[i].anim < 0) continue;
+
+        explosions[i].x += -player_scroll_delta_x; // Adjust for map scroll
+        explosions[i].y += -player_scroll_delta_y;
+    }
+}
+
+// Called after updateVisibility
+void drawExplosions(){
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        if (explosions[i].anim < 0) continue;
+
+        if (VIS_TEST(explosion_visible, i)) {
+            SPR_setPosition(explosions[i].sprite_ptr, explosions[i].x, explosions[i].y);
+            SPR_setVisibility(explosions[i].sprite_ptr, VISIBLE);
+        } else {
+            SPR_setVisibility(explosions[i].sprite_ptr, HIDDEN); // Hide if off-screen
+        }
+    }
+}
+
+s16 explosionSize(u16 kind){
+    return explosion_kinds[kind].size;
+}
+
+// After a snapshot restore: running explosions get their sprites back (refreshAnims sets the frame)
+void respawnExplosionSprites(){
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        explosions[i].sprite_ptr = NULL;
+        if (explosions[i].anim >= 0){
+            explosions[i].sprite_ptr = addAtlasSprite(explosion_kinds[explosions[i].kind].sprite_def,
+                                                explosions[i].x, explosions[i].y, TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
+        }
+    }
+}
+
+void clearExplosions(){
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        stopAnim(explosions[i].anim);
+        freeExplosion(i);
+    }
+}
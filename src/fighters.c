@@ -2,6 +2,12 @@
 #include <genesis.h>
 #include "globals.h" // For Fighter struct, fighters array, player_x/y, map constants, screen_width_pixels etc.
 #include "fighters.h"
+#include "explosions.h"
+#include "game_events.h"
+#include "collision.h"
+#include "visibility.h"
+#include "sprite_atlas.h"
+#include "world.h"
 #include "resources.h" // For fighter_sprite_res
 
 void initFighters(){
@@ -48,8 +54,6 @@ void initFighters(){
         fighters[i].yrem = 0;
         fighters[i].dx = 0; // Own movement delta
         fighters[i].dy = 0;
-
-        fexplode[i].status = 0; // for explosions
     }
 }
 
@@ -74,18 +78,6 @@ void updateFighters()
             fighters[i].y += -player_scroll_delta_y; // Adjust for map scroll
 
 
-            if (fighters[i].new_fighter > 0){
-                 // Only add sprite if on screen
-                if (fighters[i].x > -8 && fighters[i].x < screen_width_pixels && // Allow slightly offscreen for smooth entry
-                    fighters[i].y > -8 && fighters[i].y < screen_height_pixels) {
-                    fighters[i].sprite_ptr = SPR_addSprite(&fighter_sprite_res,
-                                                    fighters[i].x,
-                                                    fighters[i].y,
-                                                    TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
-                    fighters[i].new_fighter = 0;
-                }
-            }
-
             // AI / Movement decision (every 30 game frames)
             if (game_nframe == 30){ // Use game_nframe
             // game_ai_rand = random() % game_ai_decision_time;
@@ -122,117 +114,77 @@ void updateFighters()
             fighters[i].x += fighters[i].dx; // Apply fighter's own movement
             fighters[i].y += fighters[i].dy;
 
-            // --- World Wrapping (relative to screen center or 0,0 world) ---
-            // This logic needs to be consistent with how scrolling and player position are handled.
-            // If fighters[i].x/y are screen coordinates that get adjusted by player_scroll_delta,
-            // then wrapping should occur when they go too far off *screen*.
-            // The original MAPSIZE logic implies world coordinates.
-            // For now, let's assume fighters[i].x/y are *screen-relative world coordinates*
-            // that get "scrolled" by player_scroll_delta_x/y.
-            // They wrap around a virtual world.
-            // if (fighters[i].x < MMAPSIZED2 - screen_width_pixels/2) fighters[i].x += MAPSIZE;
-            // if (fighters[i].x > MAPSIZED2 + screen_width_pixels/2) fighters[i].x -= MAPSIZE;
-            // if (fighters[i].y < MMAPSIZED2 - screen_height_pixels/2) fighters[i].y += MAPSIZE;
-            // if (fighters[i].y > MAPSIZED2 + screen_height_pixels/2) fighters[i].y -= MAPSIZE;
-            if (fighters[i].x >  MAPSIZED2) fighters[i].x -= MAPSIZE;
-            if (fighters[i].x < MMAPSIZED2) fighters[i].x += MAPSIZE; // Ensure positive if wrapped
-            if (fighters[i].y >  MAPSIZED2) fighters[i].y -= MAPSIZE;
-            if (fighters[i].y < MMAPSIZED2) fighters[i].y += MAPSIZE;
-
-            if (fighters[i].sprite_ptr) {
-                // Check if fighter is on screen before drawing
-                if (fighters[i].x > -8 && fighters[i].x < screen_width_pixels &&
-                    fighters[i].y > -8 && fighters[i].y < screen_height_pixels) {
-                    SPR_setPosition(fighters[i].sprite_ptr, fighters[i].x, fighters[i].y);
-                    SPR_setVisibility(fighters[i].sprite_ptr, VISIBLE);
-                } else {
-                    SPR_setVisibility(fighters[i].sprite_ptr, HIDDEN); // Hide if off-screen
-                }
-            }
-        } else if (fighters[i].status < -1){ // Fighter is exploding
-            
-            fighters[i].x += -player_scroll_delta_x; // Adjust for map scroll
-            fighters[i].y += -player_scroll_delta_y; // Adjust for map scroll
+            // Fighters recycle around the camera: wrap inside the MAPSIZE window (see world.h)
+            WRAP_WINDOW(fighters[i].x);
+            WRAP_WINDOW(fighters[i].y);
+        }
+    }
+}
 
-            if ((fighters[i].status == -9) & (fexplode[i].status == 0)){
-                // XGM2_playPCMEx(sfx_explode, sizeof(sfx_explode), SOUND_PCM_CH3, 4, FALSE, FALSE);
-                fexplode[i].sprite_ptr = SPR_addSprite(&fighter_explode_res,
+// Called after updateVisibility, so fighter_visible matches this frame's positions
+void drawFighters()
+{
+    for (s16 i = 0; i < active_fighter_count; i++) {
+        if (fighters[i].status >= 0) {
+            if (VIS_TEST(fighter_visible, i)) {
+                if (fighters[i].new_fighter > 0){ // Only add sprite once on screen
+                    fighters[i].sprite_ptr = addAtlasSprite(&fighter_sprite_res,
                                                     fighters[i].x,
                                                     fighters[i].y,
                                                     TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
-                
-                fexplode[i].status = 5;
-            } else if ((fighters[i].status == -2) & (fexplode[i].status == 0)){
-                SPR_releaseSprite(fexplode[i].sprite_ptr);
-                fexplode[i].sprite_ptr = NULL;
-
-                // fighters[i].x = (random() % (MAPSIZED2 - screen_width_pixels)) + screen_width_pixels + 144;
-                // fighters[i].y = (random() % (MAPSIZED2 - screen_height_pixels)) + screen_height_pixels + 104;
-                fighters[i].x = (random() % (screen_width_pixels_d2)) + screen_width_pixels + 144;
-                fighters[i].y = (random() % (screen_height_pixels_d2)) + screen_height_pixels + 104;
-                if (random()%2){
-                    fighters[i].x = -fighters[i].x;
-                }
-                if (random()%2){
-                    fighters[i].y = -fighters[i].y;
+                    fighters[i].new_fighter = 0;
+                } else if (fighters[i].sprite_ptr) {
+                    SPR_setPosition(fighters[i].sprite_ptr, fighters[i].x, fighters[i].y);
+                    SPR_setVisibility(fighters[i].sprite_ptr, VISIBLE);
                 }
-                
-                fighters[i].status = 1; // Active
-                fighters[i].new_fighter = 1;
-            } else if (fexplode[i].status == 0) {
-                SPR_setFrame(fexplode[i].sprite_ptr, fighters[i].status + 9);
-                fexplode[i].status = 5; // delay for next frame of animation
+            } else if (fighters[i].sprite_ptr) {
+                SPR_setVisibility(fighters[i].sprite_ptr, HIDDEN); // Hide if off-screen
             }
+        }
+    }
+}
 
-            if (fexplode[i].status > 0){
-
-                // Check if fighter is on screen before drawing
-                if (fighters[i].x > -8 && fighters[i].x < screen_width_pixels &&
-                    fighters[i].y > -8 && fighters[i].y < screen_height_pixels) {
-                    SPR_setPosition(fexplode[i].sprite_ptr, fighters[i].x, fighters[i].y);
-                    SPR_setVisibility(fexplode[i].sprite_ptr, VISIBLE);
-                } else {
-                    SPR_setVisibility(fexplode[i].sprite_ptr, HIDDEN); // Hide if off-screen
-                }
-
-                // SPR_setPosition(fexplode[i].sprite_ptr, fighters[i].x, fighters[i].y);
-                fexplode[i].status -= 1;
-            }
+// Fighter destroyed: hand the visuals to the explosion pool and bring it back off-screen.
+// Called from resolveGameEvents.
+void killFighter(s16 i){
+    if(fighters[i].sprite_ptr) SPR_releaseSprite(fighters[i].sprite_ptr);
+    fighters[i].sprite_ptr = NULL;
 
-            if (fexplode[i].status == 0){
-                fighters[i].status += 1;
-            }
-            
+    spawnExplosion(EXPLOSION_FIGHTER, fighters[i].x, fighters[i].y);
 
-            // if(fighters[i].sprite_ptr) {
-            //      //SPR_releaseSprite(fighters[i].sprite_ptr); // Done in bullet collision
-            //      //fighters[i].sprite_ptr = NULL;
-            // }
-            // Potentially respawn logic here if FIGHTER_RATE was used
-        }
+    // fighters[i].x = (random() % (MAPSIZED2 - screen_width_pixels)) + screen_width_pixels + 144;
+    // fighters[i].y = (random() % (MAPSIZED2 - screen_height_pixels)) + screen_height_pixels + 104;
+    fighters[i].x = (random() % (screen_width_pixels_d2)) + screen_width_pixels + 144;
+    fighters[i].y = (random() % (screen_height_pixels_d2)) + screen_height_pixels + 104;
+    if (random()%2){
+        fighters[i].x = -fighters[i].x;
     }
+    if (random()%2){
+        fighters[i].y = -fighters[i].y;
+    }
+
+    fighters[i].status = 1; // Active
+    fighters[i].new_fighter = 1;
 }
 
 void collideFighters(){
     for (s16 i = 0; i < active_fighter_count; i++) {
         if (fighters[i].status >= 0) {
 
-            if (fighters[i].x     < player_x + 16 && // fighter left < bullet right
-                fighters[i].x + 8 > player_x      && // fighter right > bullet left
-                fighters[i].y     < player_y + 16 && // fighter top < bullet bottom
-                fighters[i].y + 8 > player_y)       // fighter bottom > bullet top
+            // Swept over the player's full move (screen step + scroll), so boosting can't tunnel.
+            // Fighters have not scrolled yet this frame, so the move is taken in their frame.
+            if (spriteSweptHit(&player_sprite_hit, player_rotation_index,
+                               sweepStart(player_x, player_vx_applied, player_scroll_delta_x),
+                               sweepStart(player_y, player_vy_applied, player_scroll_delta_y),
+                               player_vx_applied, player_vy_applied,
+                               &fighter_sprite_hit, FIGHTER_FRAME, fighters[i].x, fighters[i].y))
             {
                 fighters[i].status = -9; // Deactivate fighter (-9 means we do an explosion)
-                if(fighters[i].sprite_ptr) SPR_releaseSprite(fighters[i].sprite_ptr);
-                fighters[i].sprite_ptr = NULL;
 
                 if(shield_status <= 0){
-                    fighters_score += 1; // If shield down, enemy gets a point
-                    XGM2_playPCMEx(sfx_explode, sizeof(sfx_explode), SOUND_PCM_CH2, 4, TRUE, FALSE);
+                    pushGameEvent(EVT_PLAYER_HIT, CAUSE_FIGHTER, i, -1); // If shield down, enemy gets a point
                 } else {
-                    player_score += 1;   // If shield is up, player gets a point
-                    game_score += 25;
-                    XGM2_playPCMEx(sfx_explode, sizeof(sfx_explode), SOUND_PCM_CH3, 4, FALSE, FALSE);
+                    pushGameEvent(EVT_KILL, CAUSE_SHIELD, i, -1);        // If shield is up, player gets a point
                 }
 
             }
@@ -0,0 +1,102 @@
+// frame_pace.c
+#include <genesis.h>
+#include "globals.h"
+#include "frame_pace.h"
+
+static u32 pace_vtimer;         // vtimer at the last sample
+static u16 pace_frames;         // Frames sampled
+static FrameOverrun overrun_log[FRAME_PACE_LOG];
+static u16 overrun_head;        // Next slot in overrun_log
+static u16 overrun_logged;      // Entries in overrun_log
+
+#if FRAME_PACE_INDICATOR
+static u16 drops_shown = 0xFFFF;
+static u16 indicator_timer;     // Frames the indicator stays lit after a drop
+#endif
+
+void initFramePace(){
+    frame_drops_total = 0;
+    frame_drop_streak = 0;
+    frame_drop_streak_max = 0;
+    overrun_head = 0;
+    overrun_logged = 0;
+    pace_frames = 0;
+    pace_vtimer = vtimer;
+}
+
+void resyncFramePace(){
+    pace_vtimer = vtimer;
+}
+
+static void logOverrun(u16 dropped){
+    FrameOverrun* o = &overrun_log[overrun_head];
+    overrun_head = (overrun_head + 1) & (FRAME_PACE_LOG - 1);
+    if (overrun_logged < FRAME_PACE_LOG) overrun_logged += 1;
+
+    u16 alive = 0;
+    for (s16 i = 0; i < active_fighter_count; i++) {
+        if (fighters[i].status >= 0) alive += 1;
+    }
+    u16 blasts = 0;
+    for (u16 i = 0; i < EXPLOSION_MAX; i++) {
+        if (explosions[i].anim >= 0) blasts += 1;
+    }
+    u16 placed = 0;
+    for (u16 m = 0; m < NMINE_MAX; m++) {
+        if (mines[m].status != 0) placed += 1;
+    }
+
+    o->frame = pace_frames;
+    o->game_nframe = game_nframe;
+    o->dropped = (dropped > 255) ? 255 : dropped;
+    o->fighters = alive;
+    o->bullets = bullet_pool.live_count + sbullet_pool.live_count;
+    o->ebullets = ebullet_pool.live_count;
+    o->explosions = blasts;
+    o->mines = placed;
+}
+
+void updateFramePace(){
+    u32 now = vtimer;
+    u16 dropped = (now - pace_vtimer) - 1;  // One tick per frame is on time
+    pace_vtimer = now;
+    pace_frames += 1;
+
+    if ((s16)dropped <= 0){
+        frame_drop_streak = 0;
+        return;
+    }
+
+    frame_drops_total += dropped;
+    frame_drop_streak += dropped;
+    if (frame_drop_streak > frame_drop_streak_max) frame_drop_streak_max = frame_drop_streak;
+    logOverrun(dropped);
+
+#if FRAME_PACE_INDICATOR
+    indicator_timer = FRAME_PACE_SHOW;
+#endif
+}
+
+const FrameOverrun* frameOverrun(u16 age){
+    if (age >= overrun_logged) return NULL;
+    return &overrun_log[(overrun_head - 1 - age) & (FRAME_PACE_LOG - 1)];
+}
+
+void drawFramePace(){
+#if FRAME_PACE_INDICATOR
+    if (indicator_timer > 0){
+        indicator_timer -= 1;
+        if (indicator_timer == 0){
+            VDP_clearTextBG(HUD_PLANE, 1, 2, 10);
+            drops_shown = 0xFFFF;
+            return;
+        }
+    }
+    if (indicator_timer > 0 && frame_drops_total != drops_shown){
+        drops_shown = frame_drops_total;
+        char text[6];
+        VDP_drawTextBG(HUD_PLANE, "DROP", 1, 2);
+        intToStr(frame_drops_total, text, 1); VDP_drawTextBG(HUD_PLANE, text, 6, 2);
+    }
+#endif
+}
@@ -15,6 +15,9 @@ s16 scroll_boundary_y1; s16 scroll_boundary_y2;
 s16 scroll_a_x = 0; s16 scroll_a_y = 0;
 s16 scroll_b_x = 0; s16 scroll_b_y = 0;
 
+// Camera in sector coordinates
+WorldAxis camera_x; WorldAxis camera_y;
+
 // Sine/Cosine Tables
 const s16 sin_fix[] = {
       0,  65, 127, 180, 220, 246, 255, 246, 220, 180, 127,  65,
@@ -35,6 +38,27 @@ const s16 cos_fix_d2[] = {
    -127,-123,-110, -90, -63, -32,   0,  32,  63,  90, 110, 123, 127
 };
 
+// World map sectors: one byte per 8x8-tile sector of the 1024x1024 world.
+// bits 0-4 = Star_Map chunk index, bit 5 = H flip, bit 6 = V flip
+const u8 world_sectors[WORLD_SECTORS * WORLD_SECTORS] = {
+    0x61, 0x54, 0x77, 0x46, 0x26, 0x7B, 0x16, 0x05, 0x37, 0x37, 0x48, 0x12, 0x4E, 0x21, 0x01, 0x75,
+    0x2B, 0x24, 0x18, 0x42, 0x73, 0x25, 0x10, 0x4B, 0x74, 0x56, 0x16, 0x6F, 0x08, 0x33, 0x4D, 0x70,
+    0x21, 0x18, 0x1C, 0x09, 0x60, 0x1F, 0x39, 0x6D, 0x75, 0x31, 0x61, 0x51, 0x75, 0x1F, 0x51, 0x28,
+    0x48, 0x4D, 0x3B, 0x44, 0x13, 0x7D, 0x47, 0x3F, 0x7A, 0x3A, 0x71, 0x6B, 0x0C, 0x3A, 0x1C, 0x69,
+    0x1A, 0x09, 0x30, 0x26, 0x37, 0x35, 0x35, 0x6E, 0x67, 0x66, 0x5F, 0x3C, 0x05, 0x22, 0x3B, 0x33,
+    0x50, 0x0A, 0x46, 0x6B, 0x3B, 0x55, 0x35, 0x44, 0x7A, 0x40, 0x4B, 0x6F, 0x78, 0x36, 0x39, 0x4C,
+    0x7C, 0x55, 0x03, 0x3A, 0x3A, 0x67, 0x0F, 0x59, 0x18, 0x46, 0x04, 0x7C, 0x51, 0x6B, 0x39, 0x7D,
+    0x02, 0x66, 0x4D, 0x53, 0x16, 0x20, 0x16, 0x67, 0x63, 0x63, 0x44, 0x57, 0x56, 0x30, 0x45, 0x7A,
+    0x57, 0x7D, 0x64, 0x74, 0x69, 0x59, 0x75, 0x75, 0x37, 0x72, 0x38, 0x46, 0x04, 0x5E, 0x2F, 0x71,
+    0x7C, 0x5C, 0x58, 0x65, 0x6C, 0x7C, 0x4B, 0x62, 0x4E, 0x7D, 0x00, 0x0B, 0x62, 0x44, 0x61, 0x2B,
+    0x4E, 0x79, 0x7C, 0x56, 0x5B, 0x6D, 0x7B, 0x02, 0x1D, 0x13, 0x19, 0x5C, 0x51, 0x2E, 0x01, 0x24,
+    0x2F, 0x61, 0x06, 0x66, 0x58, 0x18, 0x1F, 0x06, 0x54, 0x49, 0x11, 0x32, 0x02, 0x4D, 0x35, 0x7D,
+    0x4E, 0x49, 0x5B, 0x75, 0x52, 0x65, 0x2B, 0x2B, 0x4E, 0x3A, 0x6C, 0x5A, 0x7A, 0x16, 0x04, 0x55,
+    0x0E, 0x31, 0x6F, 0x2E, 0x45, 0x3F, 0x0F, 0x76, 0x53, 0x42, 0x10, 0x4E, 0x1A, 0x47, 0x7C, 0x07,
+    0x62, 0x03, 0x6C, 0x15, 0x5E, 0x68, 0x14, 0x1D, 0x29, 0x5B, 0x57, 0x3C, 0x32, 0x3A, 0x5B, 0x7E,
+    0x2A, 0x25, 0x4C, 0x68, 0x72, 0x27, 0x4B, 0x50, 0x35, 0x44, 0x46, 0x67, 0x59, 0x69, 0x67, 0x3C
+};
+
 // Player Sprite
 Sprite* player_sprite;
 
@@ -56,35 +80,52 @@ s16 player_scroll_delta_x = 0;
 s16 player_scroll_delta_y = 0;
 s16 boost_factor = 5; 
 
-// Player D-control
-u8 dpadUp;
-u8 dpadDown;
-u8 dpadLeft;
-u8 dpadRight;
-
 // Bullet Pool and related
 Bullet bullets[NBULLET];
+BulletPool bullet_pool;
 u16 fire_cooldown_timer = 0;
-u16 current_bullet_index = 0;
 u16 new_bullet_delay_timer = 0;
 
 // EBullet Pool and related
 Bullet ebullets[NEBULLET];
+BulletPool ebullet_pool;
 u16 efire_cooldown_timer = 16;
 u16 efire_cooldown_timer_min = 4;  // 4 is the minimum.. anything less breaks game.
-u16 current_ebullet_index = 0;
+u16 fighter_cooldown[NFIGHTER_MAX];
 u16 new_ebullet_delay_timer = 0;
 
 // SBullet Pool and related
 Bullet sbullets[NSBULLET];
+BulletPool sbullet_pool;
 u16 sfire_cooldown_timer = 0;
-u16 current_sbullet_index = 0;
 u16 new_sbullet_delay_timer = 0;
 
+// Projectile pool sizes by level.  Capped by NBULLET/NEBULLET/NSBULLET storage.
+// Mines are capped by NMINE_MAX.
+const PoolSizes level_pool_sizes[POOL_SIZE_LEVELS] = {
+    // bullets  ebullets  sbullets  mines
+    {  8,       8,        3,        1 },  // Level 1
+    {  8,       8,        3,        1 },  // Level 2
+    {  8,       8,        3,        2 },  // Level 3
+    {  8,       8,        3,        2 },  // Level 4
+    {  8,       8,        3,        3 },  // Level 5
+    {  8,       8,        3,        3 },  // Level 6
+    {  8,       8,        3,        4 },  // Level 7
+    {  8,       8,        3,        4 },  // Level 8+
+};
+
+// Explosion Pool
+Explosion explosions[EXPLOSION_MAX];
+
+// Sprite animations
+Anim anims[ANIM_MAX];
+
 // Fighter Pool and related
 Fighter fighters[NFIGHTER_MAX];
-Fighter fexplode[NFIGHTER_MAX];
 s16 active_fighter_count = NFIGHTER_MAX; // Initial number of fighters
+u32 fighter_visible   = 0;
+u8 mine_visible       = 0;
+u8 explosion_visible  = 0;
 s16 fighter_speed_1 = 8;   //8
 s16 fighter_speed_2 = 256; //256 was default 9/512 is a bit too slow
 u16 game_ai_decision = 20000;      // when ships will change direction (when == game_nframe)
@@ -105,22 +146,32 @@ u16 ind_sc = 0;
 
 // Score
 s16 player_score = 0;
-s16 player_score_old = 1;
 u16 fighters_score = 0;
-u16 fighters_score_old = 1;
 u16 game_level = 1;
-u16 game_level_old = 2;
 u16 score_to_win = 100;
 u16 game_score = 0;
-u16 game_score_old = 1;
+u16 high_score = 0;
+u16 best_level = 1;
 
 // HUD
+u16 hud_dirty = HUD_DIRTY_ALL;
 u16 player_tiles;
 // u16 player_tiles_red;
 u16 coffset;
 u16 STRIP_TILE_8_IDX;
 u16 EMPTY_BAR_TILE_IDX;
 
+// Input service
+u16 joy_held = 0;
+u16 joy_pressed = 0;
+u16 joy_released = 0;
+u16 input_frame = 0;
+
+// Frame pacing
+u16 frame_drops_total = 0;
+u16 frame_drop_streak = 0;
+u16 frame_drop_streak_max = 0;
+
 // Title screen
 s16 control_style = 1;
 s16 control_style_old = 0;
@@ -130,10 +181,11 @@ u16 new_shield_delay_timer = 0;
 u16 shield_delay_max = 30;
 u16 shield_timer = 0;
 u16 shield_duration = 30;
-u16 shield_pal = 0;
 s16 shield_status = -1; // Shield is off.
-u16 shield_pal_timer = 0;
-u16 shield_pal_timer_switch = 10;
+
+// Palette effects
+u16 palette_dma_bytes = 0;
+u16 palette_dma_bytes_frame = 0;
 
 // Boost
 u16 player_boost_timer = 0;
@@ -143,13 +195,8 @@ u16 player_boost_delay_timer_max = 60; // How often the player can boost
 s16 player_boost_status = -1; // If boost is enabled
 
 // Space Mines
-s16 mine_status = 0; // No mine is placed
-s16 mine_x = 0;
-s16 mine_y = 0;
-u16 mine_timer      = 0;   // Time for mine to arm itself
-u16 mine_timer_max  = 30; // 120 -> 2 seconds to get away
-s16 mexplode_status = 0;
-Sprite* mine_sprite_ptr;
-Sprite* mexplode_sprite_ptr;
+Mine mines[NMINE_MAX];
+u16 mine_cap        = 1;
+u16 new_mine_delay_timer = 0;
 
 
@@ -0,0 +1,111 @@
+// game_events.c
+#include <genesis.h>
+#include "globals.h"
+#include "game_events.h"
+#include "sfx.h"
+#include "fighters.h"   // For killFighter
+#include "explosions.h"
+
+// Per-frame event ring.  Collision code only flags the entity and appends an event;
+// scoring, explosions, HUD invalidation and sound all happen in resolveGameEvents.
+static GameEvent game_events[GAME_EVENT_RING];
+static u16 game_event_head = 0; // Next slot to write
+static u16 game_event_tail = 0; // Next slot to resolve
+
+static void (*game_event_logger)(const GameEvent* event) = NULL;
+
+void initGameEvents(){
+    game_event_head = 0;
+    game_event_tail = 0;
+}
+
+void setGameEventLogger(void (*logger)(const GameEvent* event)){
+    game_event_logger = logger;
+}
+
+void pushGameEvent(u8 type, u8 cause, s16 index, s16 source){
+    u16 next = (game_event_head + 1) & (GAME_EVENT_RING - 1);
+    if (next == game_event_tail){
+        resolveGameEvents(); // Ring full: drain now rather than lose a score
+    }
+
+    game_events[game_event_head].type  = type;
+    game_events[game_event_head].cause = cause;
+    game_events[game_event_head].index = index;
+    game_events[game_event_head].source = source;
+    game_event_head = next;
+}
+
+// Mine is spent: swap its sprite for an explosion and free the slot
+static void detonateMine(s16 m){
+    if (mines[m].sprite_ptr) SPR_releaseSprite(mines[m].sprite_ptr);
+    mines[m].sprite_ptr = NULL;
+    spawnExplosion(EXPLOSION_MINE, mines[m].x, mines[m].y);
+    mines[m].status = 0;
+}
+
+void resolveGameEvents(){
+    s16 player_points = 0;
+    s16 fighter_points = 0;
+    u16 score_points = 0;
+
+    while (game_event_tail != game_event_head){
+        const GameEvent* e = &game_events[game_event_tail];
+
+        switch (e->type){
+            case EVT_KILL:
+                killFighter(e->index);
+                player_points += 1;
+                if (e->cause == CAUSE_BULLET)       score_points += 3;
+                else if (e->cause == CAUSE_SBULLET) score_points += 7;
+                else if (e->cause == CAUSE_SHIELD)  score_points += 25;
+                playSfx(SFX_EXPLODE);
+                break;
+
+            case EVT_PLAYER_HIT:
+                if (e->index >= 0) killFighter(e->index);
+                if (shield_status < 0){
+                    fighter_points += 1; // Score one for the bad guys
+                }
+                playSfx(SFX_EXPLODE_HIT);
+                break;
+
+            case EVT_MINE_DETONATE:
+                detonateMine(e->source);
+                if (e->index >= 0){
+                    killFighter(e->index);
+                    player_points += 5;
+                    score_points += 20;
+                } else {
+                    player_points -= 10; // Caught in your own mine
+                }
+                playSfx(SFX_MEXPLODE);
+                break;
+
+            case EVT_SHIELD_UP:
+                playSfx(SFX_DING);
+                break;
+        }
+
+        if (game_event_logger) game_event_logger(e);
+
+        game_event_tail = (game_event_tail + 1) & (GAME_EVENT_RING - 1);
+    }
+
+    // Apply the frame's totals once, with clamping
+    if (player_points){
+        player_score += player_points;
+        if (player_score < 0) player_score = 0;
+        if (player_score > (s16)score_to_win) player_score = score_to_win;
+        hud_dirty |= HUD_DIRTY_PLAYER;
+    }
+    if (fighter_points){
+        fighters_score += fighter_points;
+        if (fighters_score > score_to_win) fighters_score = score_to_win;
+        hud_dirty |= HUD_DIRTY_FIGHTERS;
+    }
+    if (score_points){
+        game_score += score_points;
+        hud_dirty |= HUD_DIRTY_SCORE;
+    }
+}
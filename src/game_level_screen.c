@@ -8,11 +8,17 @@
 #include "bullets.h"
 #include "ebullets.h"
 #include "sbullets.h"
+#include "bullet_pool.h"
 #include "fighters.h"
+#include "spaceMines.h"
 
 #include "title_screen.h"
 #include "background.h"
 #include "hud.h"
+#include "palette_fx.h"
+#include "input.h"
+#include "snapshot.h"
+#include "save.h"
 
 void level_up(){
 
@@ -20,8 +26,6 @@ void level_up(){
 	// Game over loop
 
     u8 game_over = 0;
-    u16 value;
-    u16 value_old;
     
     XGM2_stop();
     if (player_score > fighters_score){
@@ -51,10 +55,9 @@ void level_up(){
         }
 
         player_score = 0;
-        player_score_old = 1;
         fighters_score = 0;
-        fighters_score_old = 1;
         score_to_win = 100; 
+        hud_dirty = HUD_DIRTY_ALL;
 
     }
     else {
@@ -63,18 +66,19 @@ void level_up(){
 
         // Once we have a proper game loop the next 4 lines can probably be removed.
         player_score = 0;
-        player_score_old = 1;
         fighters_score = 0;
-        fighters_score_old = 1;
+        hud_dirty = HUD_DIRTY_ALL;
 
         game_over = 1;
     }
 
+    saveProgress(); // SRAM is written here, between levels, never during play
+
     VDP_drawText("Push  Start", 15, 14);
     while(1){
         
-        value = JOY_readJoypad(JOY_1);
-        if (value & BUTTON_START) {
+        updateInput();
+        if (joy_held & BUTTON_START) {
             break;
         }
 
@@ -89,24 +93,12 @@ void level_up(){
     if (game_over){
 
         
-        value_old = JOY_readJoypad(JOY_1);
-        u8 x = 1;
-        while(x){
-            value = JOY_readJoypad(JOY_1);
-            if (value != value_old){
-                x = 0;
-            } 
-            // else {
-            //     VDP_clearText(1, 5, DEBUG_TEXT_LEN + 6);
-            //     intToStr(value, text_vel_x, 5);
-            //     VDP_drawText("Button ", 1, 5);
-            //     VDP_drawText(text_vel_x , 9, 5);
-            //     value_old = value;
-            // }
-
+        // Wait for START to be let go (or any other change) so the title doesn't start straight away
+        do {
             SPR_update();
             SYS_doVBlankProcess();
-        }
+            updateInput();
+        } while (!(joy_pressed | joy_released));
 
 
         clear_sprites();
@@ -120,12 +112,12 @@ void level_up(){
         VDP_setVerticalScroll(BG_B, scroll_b_y);
 
 
-        VDP_clearText(8,  1, 8);
-        VDP_clearText(23, 1, 8);
+        VDP_clearTextBG(HUD_PLANE, 8,  1, 8);
+        VDP_clearTextBG(HUD_PLANE, 23, 1, 8);
 
         title_screen();   // Show title screen.
 
-        PAL_setPalette(PAL3, title_pal_1.data, DMA_QUEUE); // Reset PAL3 after title 
+        setPaletteFx(PAL3, title_pal_1.data); // Reset PAL3 after title 
 
         initBackground(); // Initializes tiles, maps, and initial scroll
         initHud();
@@ -134,7 +126,9 @@ void level_up(){
         initBullets();
         init_SBullets();
         initFighters();
+        initMines();
         init_eBullets();
+        initFighterFire();
 
         // Create player sprite (player_x, player_y are from game_data.c)
         // player_sprite = SPR_addSprite(&player_sprite_res,
@@ -154,11 +148,15 @@ void level_up(){
         SPR_setVisibility(player_sprite, VISIBLE);
 
         game_score = 0;
+        hud_dirty = HUD_DIRTY_ALL;
 
 
     }
 
 
+    applyLevelPoolSizes(); // game_level may have changed
+    initRewind();          // No rewinding back across a level change
+
     XGM2_play(track1);
 
 }
\ No newline at end of file
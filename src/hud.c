@@ -3,11 +3,12 @@
 #include "globals.h" 
 #include "constants.h" // BAR_WIDTH_TILES ; STRIPS_PER_TILE
 #include "hud.h"
+#include "sprite_atlas.h"
 #include "resources.h"
 
 void drawHud(){
 	// --- Draw Player Score ---
-    if (player_score != player_score_old ){
+    if (hud_dirty & HUD_DIRTY_PLAYER){
 
         // --- Add filling bar on Player side
 
@@ -46,20 +47,19 @@ void drawHud(){
 	        //                    start_x + i, start_y, DMA_QUEUE);
 
 	        tile_index_to_draw += coffset;
-	        VDP_setTileMapXY(BG_A,TILE_ATTR_FULL(PAL3,0,FALSE,FALSE,tile_index_to_draw),8+i,1);
+	        VDP_setTileMapXY(HUD_PLANE,TILE_ATTR_FULL(PAL3,0,FALSE,FALSE,tile_index_to_draw),8+i,1);
 	    }
 
 
 	    intToStr(player_score, text_vel_x, 3); // Using player_x from globals
-	    VDP_clearText(1, 1, 7);
-        VDP_drawText("You ", 1, 1); VDP_drawText(text_vel_x, 5, 1);
-        player_score_old = player_score;
+	    VDP_clearTextBG(HUD_PLANE, 1, 1, 7);
+        VDP_drawTextBG(HUD_PLANE, "You ", 1, 1); VDP_drawTextBG(HUD_PLANE, text_vel_x, 5, 1);
 
 
     }
 
     // --- Draw Enemy Score ---
-    if (fighters_score != fighters_score_old ){
+    if (hud_dirty & HUD_DIRTY_FIGHTERS){
 
     	// --- Add filling bar on Player side
 
@@ -99,31 +99,30 @@ void drawHud(){
 
 
 	        tile_index_to_draw += coffset;
-	        VDP_setTileMapXY(BG_A,TILE_ATTR_FULL(PAL3,0,FALSE,TRUE,tile_index_to_draw),30-i,1);
+	        VDP_setTileMapXY(HUD_PLANE,TILE_ATTR_FULL(PAL3,0,FALSE,TRUE,tile_index_to_draw),30-i,1);
 	    }
 
 
     	intToStr(fighters_score, text_vel_x, 3); // Using player_x from globals
-        VDP_clearText(31, 1, 8);
-        VDP_drawText(" THEM", 34, 1); VDP_drawText(text_vel_x, 31, 1);
-        fighters_score_old = fighters_score;
+        VDP_clearTextBG(HUD_PLANE, 31, 1, 8);
+        VDP_drawTextBG(HUD_PLANE, " THEM", 34, 1); VDP_drawTextBG(HUD_PLANE, text_vel_x, 31, 1);
     }
 
     // --- Draw Level Indicator ---
-    if (game_level != game_level_old ){
-        VDP_clearText(15, 2, 9);
+    if (hud_dirty & HUD_DIRTY_LEVEL){
+        VDP_clearTextBG(HUD_PLANE, 15, 2, 9);
         intToStr(game_level, text_vel_x, 3); // Using player_x from globals
-        VDP_drawText("Level ", 15, 2); VDP_drawText(text_vel_x, 21, 2);
-        game_level_old = game_level;
+        VDP_drawTextBG(HUD_PLANE, "Level ", 15, 2); VDP_drawTextBG(HUD_PLANE, text_vel_x, 21, 2);
     }
 
     // --- Draw Game Score ---
-    if (game_score != game_score_old ){
+    if (hud_dirty & HUD_DIRTY_SCORE){
         intToStr(game_score, text_vel_x, 5); // Using player_x from globals
-        VDP_drawTextBGFill(BG_A, text_vel_x, 17, 1, 5);
-        game_score_old = game_score;
+        VDP_drawTextBGFill(HUD_PLANE, text_vel_x, 17, 1, 5);
     }
 
+    hud_dirty = 0;
+
 }
 
 void initHud(){
@@ -132,6 +131,7 @@ void initHud(){
 	// player_tiles_red = VDP_loadTileSet(&player_score_red_tiles, 1, DMA);
 
 	player_tiles = ind_sc;
+	checkBelowAtlas(player_tiles + 18, "Background/HUD tiles overlap the sprite atlas"); // HUD is the last tile load above ind
 	VDP_loadTileData(player_score_tiles.tiles, player_tiles, 18, DMA);
 
 	STRIP_TILE_8_IDX   = player_tiles + 8;
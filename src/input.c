@@ -0,0 +1,88 @@
+// input.c
+#include <genesis.h>
+#include "globals.h"
+#include "input.h"
+
+// The pad is read once per frame here; every module works from the same masks.
+static u16 history[INPUT_HISTORY];  // Held masks, newest at history_head
+static u16 history_head = 0;
+static u16 held_frames = 0;         // Frames the held mask has been unchanged
+
+#if INPUT_LATENCY_PROBE
+// A press is latched on the frame it is seen and closed by the first inputResponse for
+// one of its buttons.  The response shows on screen at the next vblank, hence the +1.
+static u16 probe_buttons = 0;
+static u16 probe_frame = 0;
+static u16 latency_last = 0;
+static u16 latency_max = 0;
+static u16 latency_shown = 0xFFFF;
+#endif
+
+void initInput(){
+    joy_held = JOY_readJoypad(JOY_1);
+    joy_pressed = 0;
+    joy_released = 0;
+    for (u16 i = 0; i < INPUT_HISTORY; i++) {
+        history[i] = joy_held;
+    }
+    held_frames = 0;
+    input_frame = 0;
+}
+
+void updateInput(){
+    u16 value = JOY_readJoypad(JOY_1);
+
+    joy_pressed  = value & ~joy_held;
+    joy_released = joy_held & ~value;
+    held_frames  = (value == joy_held) ? held_frames + 1 : 0;
+    joy_held     = value;
+
+    history_head = (history_head + 1) & (INPUT_HISTORY - 1);
+    history[history_head] = value;
+    input_frame += 1;
+
+#if INPUT_LATENCY_PROBE
+    if (probe_buttons && input_frame - probe_frame > INPUT_PROBE_TIMEOUT){
+        probe_buttons = 0; // That press had no visible effect (e.g. weapon not ready)
+    }
+    if (joy_pressed && probe_buttons == 0){
+        probe_buttons = joy_pressed;
+        probe_frame = input_frame;
+    }
+#endif
+}
+
+u16 inputHistory(u16 age){
+    return history[(history_head - age) & (INPUT_HISTORY - 1)];
+}
+
+u16 inputRepeat(u16 buttons, u16 delay){
+    if (joy_pressed & buttons) return joy_pressed & buttons;
+    if (held_frames > 0 && (held_frames % delay) == 0) return joy_held & buttons;
+    return 0;
+}
+
+void inputResponse(u16 buttons){
+#if INPUT_LATENCY_PROBE
+    if (probe_buttons & buttons){
+        latency_last = input_frame - probe_frame + 1;
+        if (latency_last > latency_max) latency_max = latency_last;
+        probe_buttons = 0;
+    }
+#else
+    (void)buttons;
+#endif
+}
+
+void drawInputLatency(){
+#if INPUT_LATENCY_PROBE
+    if (latency_last != latency_shown){
+        latency_shown = latency_last;
+        char text[4];
+        VDP_clearTextBG(HUD_PLANE, 31, 2, 8);
+        VDP_drawTextBG(HUD_PLANE, "LAT", 31, 2);
+        intToStr(latency_last, text, 1); VDP_drawTextBG(HUD_PLANE, text, 35, 2);
+        intToStr(latency_max, text, 1);  VDP_drawTextBG(HUD_PLANE, text, 38, 2);
+    }
+#endif
+}
@@ -9,16 +9,33 @@
 #include "title_screen.h"      // Title screen --> setting game options
 #include "game_level_screen.h" // Handles level-ups and Game over
 #include "hud.h"               // HUD, including score
+#include "palette_fx.h"        // Palette cycles/fades with partial uploads
+#include "sfx.h"               // Sound effect requests
+#include "game_events.h"       // Kill/hit events resolved once per frame
+#include "input.h"             // Pad sampled once per frame
+#include "snapshot.h"          // State snapshots and the rewind ring
+#include "save.h"              // High score and settings in SRAM
+#include "stress.h"            // Stress scenarios (STRESS_SCENARIO)
+#include "frame_pace.h"        // Dropped-frame counters
+#include "stack_probe.h"       // Stack high-water
+#include "sprite_atlas.h"      // Sprite frames resident in VRAM
+#include "timestep.h"          // Fixed 60 Hz simulation ticks on NTSC and PAL
 
 #include "player.h"
+#include "controls.h"     // DPAD_MASK
 #include "shield.h"     // Player Shield
 #include "bullets.h"
 #include "ebullets.h"
 #include "sbullets.h"
+#include "bullet_pool.h"
 #include "spaceMines.h" // Space Mines
 
 #include "fighters.h"
+#include "explosions.h"
+#include "anim.h"
 #include "background.h"
+#include "visibility.h"
+#include "world.h"
 
 // // Palette for debug font (can be here or in globals/game_data if shared)
 // const u16 debug_font_palette[16] = {
@@ -32,13 +49,17 @@
 int main()
 {
     SYS_disableInts();
+    paintStack(); // Before anything runs deeper than main
 
     VDP_init();
-    SPR_init();
+    SPR_initEx(SPRITE_ENGINE_TILES); // Atlas sprites bring their own tiles
+    initSpriteAtlas();               // Every sprite frame into VRAM once
     JOY_init();
     JOY_setSupport(PORT_1, JOY_SUPPORT_6BTN);
+    initInput();
 
-    // XGM_setPCM(SFX_LASER, sfx_laser, sizeof(sfx_laser)); // SFX_LASER from constants.h
+    initSfx(); // Sound effect channel manager
+    initGameEvents();
 
     VDP_setScreenWidth320(); // Sets screen_width_pixels internally too via VDP_getScreenWidth
     //1 VDP_setPlaneSize(MAP_HW_WIDTH, MAP_HW_HEIGHT, TRUE); // Use TRUE for SGDK 1.7+ if using full 64x64 tilemap for one plane
@@ -47,7 +68,7 @@ int main()
     VDP_setTextPlane(BG_A);
     VDP_setTextPalette(PAL3);
     VDP_setWindowHPos(FALSE, 0);
-    VDP_setWindowVPos(FALSE, 0); // Usually 0 for top lines, or adjust
+    VDP_setWindowVPos(FALSE, HUD_WINDOW_ROWS); // HUD lives in the window over the top rows
 
     // Get and store screen dimensions
     screen_width_pixels = VDP_getScreenWidth();
@@ -62,19 +83,21 @@ int main()
     scroll_boundary_y2 = screen_height_pixels - BBY;
 
     // Load Palettes
+    initPaletteFx();
     //1 PAL_setPalette(PAL0, bg_far_palette.data, DMA_QUEUE);
-    PAL_setPalette(PAL1, player_palette.data, DMA_QUEUE);
+    setPaletteFx(PAL1, player_palette.data);
     //1 PAL_setPalette(PAL2, bg_near_palette.data, DMA_QUEUE);
-    PAL_setPalette(PAL3, title_pal_1.data, DMA_QUEUE);
+    setPaletteFx(PAL3, title_pal_1.data);
 
     // Setup Background Planes
     VDP_setScrollingMode(HSCROLL_PLANE, VSCROLL_PLANE);
 
+    loadSave();       // High score, best level and control style from SRAM
     init_game_vars(); // Set up player/enemy scores
 
     title_screen();   // Show title screen.
 
-    PAL_setPalette(PAL3, title_pal_1.data, DMA_QUEUE); // reset PAL3 after title
+    setPaletteFx(PAL3, title_pal_1.data); // reset PAL3 after title
 
     initBackground(); // Initializes tiles, maps, and initial scroll
     initHud();        // Load tiles for HUD
@@ -83,13 +106,23 @@ int main()
     initBullets();
     init_SBullets();
     initFighters();
+    initAnims();
+    initExplosions();
+    initMines();
     init_eBullets();
+    initFighterFire();
+    initRewind();
+    applyLevelPoolSizes(); // Projectile pool capacities for this level
 
     // Create player sprite (player_x, player_y are from game_data.c)
-    player_sprite = SPR_addSprite(&player_sprite_res,
+    player_sprite = addAtlasSprite(&player_sprite_res,
                                 player_x, player_y,
                                 TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
 
+#if STRESS_SCENARIO
+    stressSetup(); // Reseeded placement for the chosen scenario
+#endif
+
     // Start music
     XGM2_setLoopNumber(-1);
     XGM2_play(track1);
@@ -98,32 +131,88 @@ int main()
     VDP_setBackgroundColor(0); // first index from PAL0 
     SYS_enableInts();
 
+    s16 rotation_shown = player_rotation_index;
+    initFramePace();
+    initTimestep();
+
     // Main Game Loop
     while (1)
     {
-        handleInput();
-        playerBoost(); // Apply boost if needed.  Must be called before updatePhysics.
-        updatePhysics();
-
-        collideFighters(); // Check for collision between player and fighters 
-
-        shield_animate();
-
-        updateBullets();
-        update_SBullets();
-        updateMine();
+        updateInput();     // Pad sampled once; everything below reads joy_held/pressed/released
+        if (joy_pressed & BUTTON_MODE){
+            rewindState(REWIND_RETRY_STEPS); // Practice retry: back about two seconds
+        }
+        STRESS_BEGIN();    // Scripted input and frame clock (STRESS_SCENARIO only)
+
+        // Simulation: fixed SIM_HZ ticks, one or more per rendered frame (see timestep.c)
+        u16 ticks = timestepTicks();
+        for (u16 t = 0; t < ticks; t++) {
+            handleInput();
+            playerBoost(); // Apply boost if needed.  Must be called before updatePhysics.
+            updatePhysics();
+            advanceCamera();   // Sector coordinates follow this tick's scroll delta
+            STRESS_MARK(STRESS_T_PLAYER);
+
+            collideFighters(); // Check for collision between player and fighters 
+
+            shield_animate();
+            STRESS_MARK(STRESS_T_COLLIDE);
+
+            updateBullets();
+            update_SBullets();
+            STRESS_MARK(STRESS_T_BULLETS);
+            updateMine();
+            STRESS_MARK(STRESS_T_MINES);
+
+            updateFighters();  // Enemy fighters
+            STRESS_MARK(STRESS_T_FIGHTERS);
+            updateExplosions(); // Fighter and mine explosions
+            updateAnims();      // Every sprite animation in one pass (explosions, arming mines)
+            STRESS_MARK(STRESS_T_EXPLOSIONS);
+
+            updateVisibility(); // On-screen bitsets for this tick's positions (fire_eBullet uses them)
+            update_eBullets(); // Enemy bullets
+            fire_eBullet();    // Enemy attack
+            STRESS_MARK(STRESS_T_EBULLETS);
+
+            resolveGameEvents(); // Scores, sounds and sprite releases for this tick's hits
+            STRESS_MARK(STRESS_T_EVENTS);
+
+            updateScrolling();
+            recordRewind();    // Snapshot delta every REWIND_INTERVAL ticks
+            STRESS_MARK(STRESS_T_SCROLL);
+
+            game_nframe++; // Use game_nframe from globals
+            if (game_nframe >= 60){ // Use >= to ensure it resets
+                game_nframe = 0;
+            }
+
+            if ((fighters_score >= score_to_win) | (player_score >= score_to_win)){
+                level_up();
+                resyncFramePace(); // The level screen's own frames are not drops
+                resyncTimestep();  // ...and not ticks owed to the simulation
+                break;
+            }
+        }
 
-        updateFighters();  // Enemy fighters
-        update_eBullets(); // Enemy bullets
-        fire_eBullet();    // Enemy attack
-        
-        updateScrolling();
+        // Rendering: once per vblank
+        drawFighters();
+        drawMines();
+        drawExplosions();
+        drawScrolling();
+        STRESS_MARK(STRESS_T_DRAW);
 
+        if (player_rotation_index != rotation_shown){
+            rotation_shown = player_rotation_index;
+            inputResponse(DPAD_MASK); // Turn becomes visible at this vblank
+        }
         SPR_setFrame(player_sprite, player_rotation_index);
         SPR_setPosition(player_sprite, player_x, player_y);
 
 
         drawHud();
+        drawInputLatency(); // Only draws with INPUT_LATENCY_PROBE
+        drawFramePace();    // Only draws with FRAME_PACE_INDICATOR
 
         // // --- Draw Debug Text ---
         // VDP_clearText(1, 1, DEBUG_TEXT_LEN + 6);
@@ -146,18 +235,13 @@ int main()
         // intToStr(npos, text_vel_x, 5);
         // VDP_drawText("FGX:", 1, 2); VDP_drawText(text_vel_x, 6, 2);
 
-        if ((fighters_score >= score_to_win) | (player_score >= score_to_win)){
-            level_up();
-        }
-        
-
-        game_nframe++; // Use game_nframe from globals
-        if (game_nframe >= 60){ // Use >= to ensure it resets
-            game_nframe = 0;
-        }
-
+        updatePaletteFx();
+        updateSfx();       // Issue this frame's merged sound requests
         SPR_update();
+        STRESS_MARK(STRESS_T_PRESENT);
+        STRESS_END();      // Reports and halts after STRESS_FRAMES
         SYS_doVBlankProcess();
+        updateFramePace(); // More than one vblank since the last frame is a drop
     }
 
     
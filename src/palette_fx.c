@@ -0,0 +1,127 @@
+// palette_fx.c
+#include <genesis.h>
+#include "globals.h"    // For palette_dma_bytes counters
+#include "palette_fx.h"
+
+// Copy of what has been queued to CRAM, used to find the changed colour range.
+// DMA_QUEUE reads from here at vblank, so it must stay static.
+static u16 pal_shadow[PAL_LINES * PAL_COLORS];
+
+// Per palette line effect state
+static const PaletteCycle* pal_cycle[PAL_LINES];
+static u16 pal_cycle_key[PAL_LINES];
+static u16 pal_cycle_timer[PAL_LINES];
+
+static const u16* pal_fade_target[PAL_LINES];
+static u16 pal_fade_from[PAL_LINES][PAL_COLORS];
+static u16 pal_fade_step[PAL_LINES];
+static u16 pal_fade_frames[PAL_LINES];
+
+// Diff against the shadow copy and queue only the first..last changed entries
+static void applyPalette(u16 pal, const u16* colors){
+    u16* shadow = &pal_shadow[pal * PAL_COLORS];
+    s16 first = -1;
+    s16 last  = -1;
+
+    for (s16 i = 0; i < PAL_COLORS; i++) {
+        if (colors[i] != shadow[i]){
+            if (first < 0) first = i;
+            last = i;
+            shadow[i] = colors[i];
+        }
+    }
+
+    if (first < 0) return; // Nothing changed, nothing to upload
+
+    PAL_setColors(pal * PAL_COLORS + first, &shadow[first], last - first + 1, DMA_QUEUE);
+    palette_dma_bytes += (last - first + 1) * 2;
+}
+
+// Blend one 0x0BGR colour, each 3-bit component stepped linearly
+static u16 blendColor(u16 from, u16 to, u16 step, u16 frames){
+    u16 out = 0;
+    for (u16 shift = 0; shift < 12; shift += 4) {
+        s16 a = (from >> shift) & 0xE;
+        s16 b = (to   >> shift) & 0xE;
+        out |= (u16)((a + ((b - a) * (s16)step) / (s16)frames) & 0xE) << shift;
+    }
+    return out;
+}
+
+void initPaletteFx(){
+    // 0xFFFF is never a valid CRAM value, so the first upload of each line is complete
+    for (u16 i = 0; i < PAL_LINES * PAL_COLORS; i++) {
+        pal_shadow[i] = 0xFFFF;
+    }
+    for (u16 p = 0; p < PAL_LINES; p++) {
+        pal_cycle[p] = NULL;
+        pal_fade_target[p] = NULL;
+    }
+    palette_dma_bytes = 0;
+    palette_dma_bytes_frame = 0;
+}
+
+void setPaletteFx(u16 pal, const u16* colors){
+    pal_fade_target[pal] = NULL; // A direct set overrides any fade in progress
+    applyPalette(pal, colors);
+}
+
+void startPaletteCycle(u16 pal, const PaletteCycle* cycle){
+    pal_cycle[pal] = cycle;
+    pal_cycle_key[pal] = 0;
+    pal_cycle_timer[pal] = 0;
+    pal_fade_target[pal] = NULL;
+    applyPalette(pal, cycle->keys[0]->data);
+}
+
+void stopPaletteCycle(u16 pal){
+    pal_cycle[pal] = NULL;
+}
+
+void fadePaletteTo(u16 pal, const u16* colors, u16 frames){
+    pal_cycle[pal] = NULL;
+    if (frames == 0){
+        setPaletteFx(pal, colors);
+        return;
+    }
+    for (u16 i = 0; i < PAL_COLORS; i++) {
+        pal_fade_from[pal][i] = pal_shadow[pal * PAL_COLORS + i] & 0x0EEE;
+    }
+    pal_fade_target[pal] = colors;
+    pal_fade_step[pal] = 0;
+    pal_fade_frames[pal] = frames;
+}
+
+void updatePaletteFx(){
+    u16 blend[PAL_COLORS];
+
+    for (u16 p = 0; p < PAL_LINES; p++) {
+
+        if (pal_cycle[p]){
+            // Only touch CRAM on the frame a new keyframe starts
+            pal_cycle_timer[p] += 1;
+            if (pal_cycle_timer[p] >= pal_cycle[p]->durations[pal_cycle_key[p]]){
+                pal_cycle_timer[p] = 0;
+                pal_cycle_key[p] += 1;
+                if (pal_cycle_key[p] >= pal_cycle[p]->num_keys){
+                    pal_cycle_key[p] = 0;
+                }
+                applyPalette(p, pal_cycle[p]->keys[pal_cycle_key[p]]->data);
+            }
+
+        } else if (pal_fade_target[p]){
+            pal_fade_step[p] += 1;
+            for (u16 i = 0; i < PAL_COLORS; i++) {
+                blend[i] = blendColor(pal_fade_from[p][i], pal_fade_target[p][i], pal_fade_step[p], pal_fade_frames[p]);
+            }
+            applyPalette(p, blend); // Colours that round to the same value are not re-sent
+            if (pal_fade_step[p] >= pal_fade_frames[p]){
+                pal_fade_target[p] = NULL;
+            }
+        }
+    }
+
+    // Latch this frame's palette traffic and start counting the next one
+    palette_dma_bytes_frame = palette_dma_bytes;
+    palette_dma_bytes = 0;
+}
@@ -2,116 +2,20 @@
 #include <genesis.h>
 #include "globals.h"    // For player variables, sin_fix, cos_fix, screen boundaries
 #include "player.h"
+#include "controls.h"    // steerPlayer
 #include "bullets.h"    // For fireBullet()
 #include "sbullets.h"   // For fire_SBullet()
 #include "shield.h"     // Player Shield
 #include "spaceMines.h" // Space mines
+#include "sfx.h"        // Boost sound
 
 
 // --- Input Handling Function ---
 void handleInput()
 {
-    u16 value = JOY_readJoypad(JOY_1);
-
-    if (control_style == 0){
-        // --- Rotation ---
-        if (player_rotation_iframe >= player_rotation_iframe_threshold){
-            player_rotation_iframe = 0;
-
-            if (value & BUTTON_LEFT) {
-                if (player_rotation_index == player_rotation_index_max){
-                    player_rotation_index = 0;
-                } else {
-                    player_rotation_index += 1;
-                }
-            } else if (value & BUTTON_RIGHT) {
-                if (player_rotation_index == 0){
-                    player_rotation_index = player_rotation_index_max;
-                } else {
-                    player_rotation_index -= 1;
-                }
-            }
-        }
-        player_rotation_iframe += 1;
-
-        // --- Thrust ---
-        player_vx = 0; // Default is no thrust applied.
-        player_vy = 0;
-        if (value & BUTTON_UP) {
-            player_vx = -sin_fix[player_rotation_index];
-            player_vy = -cos_fix[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if (value & BUTTON_DOWN) {
-            player_vx =  sin_fix_d2[player_rotation_index]; // should replace with lookup to avoid division
-            player_vy =  cos_fix_d2[player_rotation_index]; 
-            player_thrust_delay_timer = 0;
-        }
-
-    } else {
-        // --- Thrust ---
-        player_vx = 0; // Default is no thrust applied.
-        player_vy = 0;
-
-        
-        dpadUp = 0 ; dpadDown = 0; dpadLeft = 0 ; dpadRight = 0;
-
-        if (value & BUTTON_UP){
-            dpadUp = 1;
-        } else if (value & BUTTON_DOWN){
-            dpadDown = 1;
-        }
+    u16 value = joy_held; // Sampled by updateInput at the top of the frame
 
-        if (value & BUTTON_LEFT){
-            dpadLeft = 1;
-        } else if (value & BUTTON_RIGHT){
-            dpadRight = 1;
-        }
-
-
-        if ((dpadUp) & (dpadRight)){
-            player_rotation_index = 21;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if ((dpadRight) & (dpadDown)){
-            player_rotation_index = 15;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if ((dpadDown) & (dpadLeft)){
-            player_rotation_index = 9;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if ((dpadLeft) & (dpadUp)){
-            player_rotation_index = 3;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if (dpadUp){
-            player_rotation_index = 0;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if (dpadRight){
-            player_rotation_index = 18;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if (dpadDown){
-            player_rotation_index = 12;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        } else if (dpadLeft){
-            player_rotation_index = 6;
-            player_vx = -sin_fix_d2[player_rotation_index];
-            player_vy = -cos_fix_d2[player_rotation_index];
-            player_thrust_delay_timer = 0;
-        }
-
-    }
-    
+    steerPlayer(value); // Rotation and thrust for the control style bound at the title screen
 
     // Fire main weapon
     if (value & BUTTON_B) {
@@ -135,7 +39,7 @@ void handleInput()
             player_boost_status = 1;
             player_boost_delay_timer = 0;
             player_boost_timer = 0;
-            XGM2_playPCMEx(sfx_turbo, sizeof(sfx_turbo), SOUND_PCM_CH2, 3, FALSE, FALSE);
+            playSfx(SFX_TURBO);
         } 
     }
 
@@ -154,6 +58,9 @@ void handleInput()
     if (value & BUTTON_Y){
         placeMine();
     }
+    if (new_mine_delay_timer < MINE_PLACE_DELAY){
+        new_mine_delay_timer += 1;
+    }
 
 }
 
@@ -0,0 +1,118 @@
+// save.c
+#include <genesis.h>
+#include "globals.h"
+#include "save.h"
+#include "controls.h"
+
+// One slot.  The checksum covers every byte before it and is written last, so a
+// half-written slot fails its check and loadSave falls back to the other one.
+typedef struct {
+    u16 magic;          // SAVE_MAGIC, changes with the layout
+    u16 sequence;       // Incremented per write; the newer valid slot wins
+    u16 high_score;
+    u16 best_level;
+    u16 control_style;
+    u16 checksum;
+} SaveRecord;
+
+#define SAVE_BODY_BYTES (sizeof(SaveRecord) - sizeof(u16)) // Everything before the checksum
+
+static SaveRecord save_record;  // Copy of the last record written or loaded
+static u16 save_slot;           // Slot holding save_record
+static u16 save_valid;          // save_record matches a slot in SRAM
+
+// Fletcher-16 over the record up to the checksum
+static u16 saveChecksum(const SaveRecord* r){
+    const u8* p = (const u8*)r;
+    u16 a = 0, b = 0;
+    for (u16 i = 0; i < SAVE_BODY_BYTES; i++) {
+        a = (a + p[i]) % 255;
+        b = (b + a) % 255;
+    }
+    return (b << 8) | a;
+}
+
+static u16 readSlot(u16 slot, SaveRecord* r){
+    u8* p = (u8*)r;
+    u32 base = slot * SAVE_SLOT_BYTES;
+    for (u16 i = 0; i < sizeof(SaveRecord); i++) {
+        p[i] = SRAM_readByte(base + i);
+    }
+    return r->magic == SAVE_MAGIC && r->checksum == saveChecksum(r);
+}
+
+static void writeSlot(u16 slot, const SaveRecord* r){
+    const u8* p = (const u8*)r;
+    u32 base = slot * SAVE_SLOT_BYTES;
+    SRAM_writeByte(base + SAVE_BODY_BYTES, 0);     // Invalid until the last write
+    SRAM_writeByte(base + SAVE_BODY_BYTES + 1, 0);
+    for (u16 i = 0; i < SAVE_BODY_BYTES; i++) {
+        SRAM_writeByte(base + i, p[i]);
+    }
+    SRAM_writeByte(base + SAVE_BODY_BYTES + 1, p[SAVE_BODY_BYTES + 1]);
+    SRAM_writeByte(base + SAVE_BODY_BYTES, p[SAVE_BODY_BYTES]);
+}
+
+void loadSave(){
+    SaveRecord r[SAVE_SLOTS];
+    u16 valid[SAVE_SLOTS];
+
+    SRAM_enableRO();
+    for (u16 s = 0; s < SAVE_SLOTS; s++) {
+        valid[s] = readSlot(s, &r[s]);
+    }
+    SRAM_disable();
+
+    // Newest valid slot; sequence wraps, so compare by signed difference
+    s16 best = -1;
+    for (u16 s = 0; s < SAVE_SLOTS; s++) {
+        if (valid[s] && (best < 0 || (s16)(r[s].sequence - r[best].sequence) > 0)) {
+            best = s;
+        }
+    }
+
+    if (best < 0){
+        // Blank or corrupt SRAM: keep the defaults, the first write goes to slot 0
+        memset(&save_record, 0, sizeof(save_record));
+        save_record.magic = SAVE_MAGIC;
+        save_record.control_style = control_style;
+        save_slot = SAVE_SLOTS - 1;
+        save_valid = 0;
+        return;
+    }
+
+    save_record = r[best];
+    save_slot = best;
+    save_valid = 1;
+
+    high_score = save_record.high_score;
+    best_level = save_record.best_level;
+    if (save_record.control_style < CONTROL_STYLE_COUNT){
+        control_style = save_record.control_style;
+    }
+}
+
+void saveProgress(){
+    if (game_score > high_score) high_score = game_score;
+    if (game_level > best_level) best_level = game_level;
+
+    if (save_valid &&
+        save_record.high_score == high_score &&
+        save_record.best_level == best_level &&
+        save_record.control_style == (u16)control_style){
+        return; // Nothing new, leave SRAM alone
+    }
+
+    save_record.sequence += 1;
+    save_record.high_score = high_score;
+    save_record.best_level = best_level;
+    save_record.control_style = control_style;
+    save_record.checksum = saveChecksum(&save_record);
+
+    save_slot = (save_slot + 1) % SAVE_SLOTS; // Never overwrite the newest good record
+
+    SRAM_enable();
+    writeSlot(save_slot, &save_record);
+    SRAM_disable();
+    save_valid = 1;
+}
@@ -2,18 +2,17 @@
 #include <genesis.h>
 #include "globals.h" // For Bullet struct, bullets array, player_x/y, sin_fix, cos_fix, screen_width_pixels, etc.
 #include "sbullets.h"
+#include "bullet_pool.h"
+#include "game_events.h"
+#include "collision.h"
+#include "sfx.h"
+#include "input.h"
+#include "sprite_atlas.h"
 #include "resources.h" // For bullet_sprite_res
 
 // --- Initialize S_Bullet Pool ---
 void init_SBullets() {
-	for (u16 i = 0; i < NSBULLET; i++) {
-        sbullets[i].status       = -1; // Inactive
-        sbullets[i].new_bullet   = 0;
-        sbullets[i].sprite_ptr   = NULL;
-        sbullets[i].bvxrem       = 0;
-        sbullets[i].bvyrem       = 0;
-    }
-    current_sbullet_index = 0;
+	initBulletPool(&sbullet_pool, sbullets, NSBULLET);
     new_sbullet_delay_timer = 0; // Already in player.c, maybe move shared timer to globals
 }
 
@@ -24,38 +23,25 @@ void fire_SBullet(){
 
 		new_sbullet_delay_timer = 0; // reset timer
 
-		if ( (sbullets[0].status<0) & (sbullets[1].status<0) & (sbullets[2].status<0)){
-
-			sbullets[0].status = player_rotation_index - 1;
-			if (sbullets[0].status > player_rotation_index_max){
-                sbullets[0].status = 0;
-            } else if (sbullets[0].status < 0){
-                sbullets[0].status = player_rotation_index_max;
-            }
+		if (bulletPoolFree(&sbullet_pool) >= SBULLET_SPREAD){ // Fire while a whole spread fits
 
-			sbullets[1].status = player_rotation_index    ;
-			if (sbullets[1].status > player_rotation_index_max){
-                sbullets[1].status = 0;
-            } else if (sbullets[1].status < 0){
-                sbullets[1].status = player_rotation_index_max;
-            }
+            for (s16 k = 0; k < SBULLET_SPREAD; k++) {
+                s16 b = allocBullet(&sbullet_pool);
 
-			sbullets[2].status = player_rotation_index + 1;
-			if (sbullets[2].status > player_rotation_index_max){
-                sbullets[2].status = 0;
-            } else if (sbullets[2].status < 0){
-                sbullets[2].status = player_rotation_index_max;
-            }
+                // Spread directions: rotation - 1, rotation, rotation + 1
+                sbullets[b].status = player_rotation_index + k - SBULLET_SPREAD / 2;
+                if (sbullets[b].status > player_rotation_index_max){
+                    sbullets[b].status = 0;
+                } else if (sbullets[b].status < 0){
+                    sbullets[b].status = player_rotation_index_max;
+                }
 
-            for (u16 i = 0; i < NSBULLET; i++) {
-		        sbullets[i].new_bullet = 1;
-		        sbullets[i].x = player_x + 4; // Offset from player center
-		        sbullets[i].y = player_y + 4;
-		        sbullets[i].bvxrem = 0;
-		        sbullets[i].bvyrem = 0;
+		        sbullets[b].new_bullet = 1;
+		        sbullets[b].x = player_x + 4; // Offset from player center
+		        sbullets[b].y = player_y + 4;
 		    }
 
-		    XGM2_playPCMEx(sfx_sbullet, sizeof(sfx_sbullet), SOUND_PCM_CH2, 2, FALSE, FALSE);
+		    playSfx(SFX_SBULLET);
 
 		}
 
@@ -68,38 +54,44 @@ void update_SBullets(){
 	s16 bvx_req, bvy_req;       // Requested velocity per bullet
     s16 bvx_applied, bvy_applied; // Applied velocity (after remainder)
 
-    for (s16 i = 0; i < NSBULLET; i++) {
+    s16 next;
+    for (s16 i = sbullet_pool.live_head; i >= 0; i = next) { // Live bullets only
+        next = sbullets[i].next; // Saved before a free relinks this entry
         if (sbullets[i].status >= 0) { // If bullet is active
             if (sbullets[i].new_bullet > 0){
-                sbullets[i].sprite_ptr = SPR_addSprite(&sbullet_sprite_res,
+                sbullets[i].sprite_ptr = addAtlasSprite(&sbullet_sprite_res,
                                                 sbullets[i].x,
                                                 sbullets[i].y,
                                                 TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
                 sbullets[i].new_bullet = 0;
+                inputResponse(BUTTON_C); // Shot is on screen from this vblank
             }
 
-            // Collision with fighters
+            // Step for this frame
+            bvx_req = -sin_fix[sbullets[i].status]; // Using stored direction
+            bvy_req = -cos_fix[sbullets[i].status];
+
+            // Speed adjustment (>>6 means divide by 64, so sin/cos are scaled up)
+            // Original code implies sin_fix/cos_fix are scaled by 255.
+            // For a speed of 4 pixels/frame, 255 / 64 is approx 4.
+            bvx_applied = ( (bvx_req + sbullets[i].bvxrem) >> 6);
+            bvy_applied = ( (bvy_req + sbullets[i].bvyrem) >> 6);
+
+            // Motion relative to the fighters, which will scroll by -player_scroll_delta this frame
+            s16 rdx = bvx_applied + player_scroll_delta_x;
+            s16 rdy = bvy_applied + player_scroll_delta_y;
+
+            // Collision with fighters, swept over this frame's step so boosting can't tunnel
             for (u16 f = 0; f < active_fighter_count; f++) {
                 if (fighters[f].status >= 0){ // If fighter is active
-                    // Simple AABB collision check (8x8 sprite assumed for fighter, 4x4 for bullet, adjust as needed)
-                    if (fighters[f].x     < sbullets[i].x + 4 && // fighter left < bullet right
-                        fighters[f].x + 8 > sbullets[i].x     && // fighter right > bullet left
-                        fighters[f].y     < sbullets[i].y + 4 && // fighter top < bullet bottom
-                        fighters[f].y + 8 > sbullets[i].y)       // fighter bottom > bullet top
+                    if (spriteSweptHit(&sbullet_sprite_hit, 0, sbullets[i].x, sbullets[i].y, rdx, rdy,
+                                       &fighter_sprite_hit, FIGHTER_FRAME, fighters[f].x, fighters[f].y))
                     {
-                        sbullets[i].status = -1; // Deactivate bullet
-                        if(sbullets[i].sprite_ptr) SPR_releaseSprite(sbullets[i].sprite_ptr);
-                        sbullets[i].sprite_ptr = NULL;
-
-                        fighters[f].status = -9; // Deactivate fighter (-8 means we do an explosion)
-                        if(fighters[f].sprite_ptr) SPR_releaseSprite(fighters[f].sprite_ptr);
-                        fighters[f].sprite_ptr = NULL;
-                        XGM2_playPCMEx(sfx_explode, sizeof(sfx_explode), SOUND_PCM_CH3, 4, FALSE, FALSE);
-
-                        player_score +=1;
-                        game_score +=7;
-                        
-                        // Potentially add explosion, score, sound effect here
+                        freeBullet(&sbullet_pool, i); // Deactivate bullet
+
+                        fighters[f].status = -9; // Deactivate fighter (-9 means we do an explosion)
+                        pushGameEvent(EVT_KILL, CAUSE_SBULLET, f, -1); // Score, sound and sprite release
+
                         break; // Bullet can only hit one fighter per frame
                     }
                 }
@@ -107,14 +99,6 @@ void update_SBullets(){
 
             // If bullet still active after collision checks
             if (sbullets[i].status >= 0) {
-                bvx_req = -sin_fix[sbullets[i].status]; // Using stored direction
-                bvy_req = -cos_fix[sbullets[i].status];
-
-                // Speed adjustment (>>6 means divide by 64, so sin/cos are scaled up)
-                // Original code implies sin_fix/cos_fix are scaled by 255.
-                // For a speed of 4 pixels/frame, 255 / 64 is approx 4.
-                bvx_applied = ( (bvx_req + sbullets[i].bvxrem) >> 6);
-                bvy_applied = ( (bvy_req + sbullets[i].bvyrem) >> 6);
                 sbullets[i].bvxrem  = bvx_req + sbullets[i].bvxrem - bvx_applied * 64;
                 sbullets[i].bvyrem  = bvy_req + sbullets[i].bvyrem - bvy_applied * 64;
                 sbullets[i].x += bvx_applied;
@@ -125,9 +109,7 @@ void update_SBullets(){
                     sbullets[i].y > 0 && sbullets[i].y < screen_height_pixels) {
                     if(sbullets[i].sprite_ptr) SPR_setPosition(sbullets[i].sprite_ptr, sbullets[i].x, sbullets[i].y);
                 } else {
-                    sbullets[i].status = -1; // Deactivate
-                    if(sbullets[i].sprite_ptr) SPR_releaseSprite(sbullets[i].sprite_ptr);
-                    sbullets[i].sprite_ptr = NULL;
+                    freeBullet(&sbullet_pool, i); // Deactivate
                 }
             }
 
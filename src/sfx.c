@@ -0,0 +1,102 @@
+// sfx.c
+#include <genesis.h>
+#include "globals.h"
+#include "sfx.h"
+#include "resources.h" // For sfx_* samples
+
+typedef struct {
+    const u8* sample;
+    u32 len;
+    u16 priority;   // 0-15, higher wins (also passed to the XGM2 driver)
+    bool half_rate;
+} SfxDef;
+
+static const SfxDef sfx_defs[SFX_COUNT] = {
+    [SFX_LASER]       = { sfx_laser,    sizeof(sfx_laser),    2,  FALSE },
+    [SFX_SBULLET]     = { sfx_sbullet,  sizeof(sfx_sbullet),  2,  FALSE },
+    [SFX_ELASER]      = { sfx_elaser,   sizeof(sfx_elaser),   1,  TRUE  },
+    [SFX_EXPLODE]     = { sfx_explode,  sizeof(sfx_explode),  4,  FALSE },
+    [SFX_EXPLODE_HIT] = { sfx_explode,  sizeof(sfx_explode),  4,  TRUE  },
+    [SFX_MEXPLODE]    = { sfx_mexplode, sizeof(sfx_mexplode), 4,  FALSE },
+    [SFX_TURBO]       = { sfx_turbo,    sizeof(sfx_turbo),    3,  FALSE },
+    [SFX_DING]        = { sfx_ding,     sizeof(sfx_ding),     14, FALSE },
+};
+
+// PCM channels handed out by the manager (CH1 is left to the music)
+static const u16 sfx_channel[SFX_CHANNELS] = { SOUND_PCM_CH2, SOUND_PCM_CH3 };
+
+static u16 sfx_pending; // Bitmask of SfxId requested this frame
+static u16 sfx_frame;   // Local frame clock for channel start/end times
+
+static s16 chan_sfx[SFX_CHANNELS];      // SfxId playing, -1 if idle
+static u16 chan_priority[SFX_CHANNELS];
+static u16 chan_start[SFX_CHANNELS];    // sfx_frame the cue started (recency)
+static u16 chan_end[SFX_CHANNELS];      // Estimated sfx_frame the cue finishes
+
+void initSfx(){
+    sfx_pending = 0;
+    sfx_frame = 0;
+    for (u16 c = 0; c < SFX_CHANNELS; c++) {
+        chan_sfx[c] = -1;
+    }
+}
+
+void playSfx(SfxId id){
+    sfx_pending |= 1 << id;
+}
+
+// Channel for a new cue: the one already playing the same cue, else an idle one,
+// else the lowest priority (oldest on ties).  Channels started this frame are skipped
+// so each channel gets at most one driver command per frame.  -1 if none is usable.
+static s16 pickChannel(s16 id){
+    s16 best = -1;
+
+    for (s16 c = 0; c < SFX_CHANNELS; c++) {
+        if (chan_sfx[c] >= 0 && chan_start[c] == sfx_frame) continue;
+        if (chan_sfx[c] == id || chan_sfx[c] < 0) return c;
+
+        if (best < 0 ||
+            chan_priority[c] < chan_priority[best] ||
+            (chan_priority[c] == chan_priority[best] && (s16)(chan_start[c] - chan_start[best]) < 0)){
+            best = c;
+        }
+    }
+    return best;
+}
+
+void updateSfx(){
+    sfx_frame += 1;
+
+    // Free channels whose cue has run out
+    for (u16 c = 0; c < SFX_CHANNELS; c++) {
+        if (chan_sfx[c] >= 0 && (s16)(sfx_frame - chan_end[c]) >= 0){
+            chan_sfx[c] = -1;
+        }
+    }
+
+    // Serve requests highest priority first
+    while (sfx_pending){
+        s16 id = -1;
+        for (s16 i = 0; i < SFX_COUNT; i++) {
+            if ((sfx_pending & (1 << i)) && (id < 0 || sfx_defs[i].priority > sfx_defs[id].priority)){
+                id = i;
+            }
+        }
+        sfx_pending &= ~(1 << id);
+
+        s16 c = pickChannel(id);
+        if (c < 0) continue;                                                   // All channels used this frame
+        if (chan_sfx[c] >= 0 && chan_priority[c] > sfx_defs[id].priority) continue; // Don't stomp a more important cue
+
+        const SfxDef* def = &sfx_defs[id];
+        u16 frames = def->len / SFX_PCM_BYTES_PER_FRAME;
+        if (def->half_rate) frames *= 2;
+
+        XGM2_playPCMEx(def->sample, def->len, sfx_channel[c], def->priority, def->half_rate, FALSE);
+
+        chan_sfx[c]      = id;
+        chan_priority[c] = def->priority;
+        chan_start[c]    = sfx_frame;
+        chan_end[c]      = sfx_frame + frames + 1;
+    }
+}
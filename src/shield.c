@@ -2,29 +2,46 @@
 #include <genesis.h>
 #include "globals.h" // For Bullet struct, bullets array, player_x/y, sin_fix, cos_fix, screen_width_pixels, etc.
 #include "shield.h"
+#include "palette_fx.h"
+#include "game_events.h"
 #include "resources.h" 
 
+// Shield flash: PAL1 cycles through these while the shield is up
+static const Palette* const shield_pal_keys[3] = { &player_pal3, &player_pal4, &player_pal2 };
+static const u16 shield_pal_durations[3] = { SHIELD_PAL_FRAMES, SHIELD_PAL_FRAMES, SHIELD_PAL_FRAMES };
+static const PaletteCycle shield_pal_cycle = { shield_pal_keys, shield_pal_durations, 3 };
+
 void enableShield(){
 	if (new_shield_delay_timer >= shield_delay_max){ // This timer is incremented in handleInput
         
         new_shield_delay_timer = 0;
 
         shield_timer  	 = 0; // Start timer for Shield duration
-        shield_pal    	 = 0; // Palette for Shield display
         shield_status 	 = 1; // Turn on shield 
-        shield_pal_timer = 0; // Timer for palette switches
+        startPaletteCycle(PAL1, &shield_pal_cycle); // Palette for Shield display
 
-        XGM2_playPCMEx(sfx_ding, sizeof(sfx_ding), SOUND_PCM_CH2, 14, FALSE, FALSE); // 14 = high-priority
+        pushGameEvent(EVT_SHIELD_UP, CAUSE_NONE, -1, -1); // Plays the (high priority) shield sound
 
     }
 }
 
+// After a snapshot restore: put PAL1 back in step with shield_status
+void restoreShieldFx(){
+	if (shield_status == 1){
+		startPaletteCycle(PAL1, &shield_pal_cycle);
+	} else {
+		stopPaletteCycle(PAL1);
+		setPaletteFx(PAL1, player_palette.data);
+	}
+}
+
 void shield_animate(){
 
 	if (shield_timer > shield_duration){
 
 		shield_status = -1;  // Turn off shield
-		PAL_setPalette(PAL1, player_palette.data, DMA_QUEUE);
+		stopPaletteCycle(PAL1);
+		setPaletteFx(PAL1, player_palette.data);
 		new_shield_delay_timer = 0; // Reset time for when shield is ready.
 		shield_timer = 0;			// Reset shield_timer
 
@@ -32,22 +49,7 @@ void shield_animate(){
 
 	} else if (shield_status == 1){
 
-		if (shield_pal_timer > shield_pal_timer_switch){
-			shield_pal = (shield_pal + 1) % 3;
-			if (shield_pal == 0){
-				PAL_setPalette(PAL1, player_pal2.data, DMA_QUEUE);
-			} else if (shield_pal == 1){
-				PAL_setPalette(PAL1, player_pal3.data, DMA_QUEUE);
-			} else if (shield_pal == 2){
-				PAL_setPalette(PAL1, player_pal4.data, DMA_QUEUE);
-			}
-			shield_pal_timer = 0; // Reset timer.
-		}
-
-		
-
-		shield_pal_timer += 1;
-		shield_timer += 1;
+		shield_timer += 1; // Palette flashing is advanced by updatePaletteFx
 
 	}
 
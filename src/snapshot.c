@@ -0,0 +1,183 @@
+// snapshot.c
+#include <genesis.h>
+#include "globals.h"
+#include "snapshot.h"
+#include "clear_sprites.h"
+#include "ebullets.h"
+#include "spaceMines.h"
+#include "explosions.h"
+#include "shield.h"
+#include "anim.h"
+
+// --- Snapshot ---
+
+#define SNAPSHOT_SAVE(v)    memcpy(&s->v, &v, sizeof(v));
+#define SNAPSHOT_LOAD(v)    memcpy(&v, &s->v, sizeof(v));
+
+// Sprite pointers are meaningless in a snapshot; keeping them 0 also keeps the deltas small
+static void scrubSprites(GameSnapshot* s){
+    for (u16 i = 0; i < NBULLET; i++)       s->bullets[i].sprite_ptr = NULL;
+    for (u16 i = 0; i < NEBULLET; i++)      s->ebullets[i].sprite_ptr = NULL;
+    for (u16 i = 0; i < NSBULLET; i++)      s->sbullets[i].sprite_ptr = NULL;
+    for (u16 i = 0; i < NFIGHTER_MAX; i++)  s->fighters[i].sprite_ptr = NULL;
+    for (u16 i = 0; i < NMINE_MAX; i++)     s->mines[i].sprite_ptr = NULL;
+    for (u16 i = 0; i < EXPLOSION_MAX; i++) s->explosions[i].sprite_ptr = NULL;
+}
+
+static void flagNewBullets(Bullet* items, u16 size){
+    for (u16 i = 0; i < size; i++) {
+        if (items[i].status >= 0) items[i].new_bullet = 1; // update re-adds the sprite
+    }
+}
+
+void saveSnapshot(GameSnapshot* s){
+    s->rng_seed = random();
+    setRandomSeed(s->rng_seed);
+
+    SNAPSHOT_FIELDS(SNAPSHOT_SAVE)
+    scrubSprites(s);
+}
+
+void loadSnapshot(const GameSnapshot* s){
+    clear_sprites(); // Release everything live before the arrays are overwritten
+
+    SNAPSHOT_FIELDS(SNAPSHOT_LOAD)
+    setRandomSeed(s->rng_seed);
+
+    flagNewBullets(bullets, NBULLET);
+    flagNewBullets(ebullets, NEBULLET);
+    flagNewBullets(sbullets, NSBULLET);
+    for (s16 i = 0; i < active_fighter_count; i++) {
+        fighters[i].new_fighter = 1; // drawFighters re-adds the sprite once on screen
+    }
+    respawnMineSprites();
+    respawnExplosionSprites();
+    refreshAnims();     // Saved frames onto the new sprites
+    rebuildFighterFire();
+    restoreShieldFx();
+
+    SPR_setVisibility(player_sprite, VISIBLE);
+    hud_dirty = HUD_DIRTY_ALL;
+}
+
+// --- Rewind ring ---
+// rewind_state is always the newest snapshot S(n).  Record k holds RLE(S(k) ^ S(k-1)), so
+// walking back from the newest record turns rewind_state into older snapshots without
+// any keyframes.  The byte ring is a FIFO: the oldest records are dropped to make room.
+//
+// Record encoding, repeated until the snapshot is covered:
+//   [zero run 0-255] [literal count 0-255] [literal XOR bytes]
+
+static GameSnapshot rewind_state;
+static GameSnapshot rewind_scratch;
+static u8 rewind_bytes[REWIND_BYTES];
+static u16 rec_start[REWIND_RECORDS];
+static u16 rec_len[REWIND_RECORDS];
+static u16 rec_first;       // Oldest record
+static u16 rec_count;
+static u16 bytes_used;
+static u16 bytes_head;      // Next byte to write (masked with REWIND_BYTES - 1)
+static u16 rewind_timer;
+static u16 rewind_valid;    // rewind_state holds a snapshot
+
+// Longest record: alternating changed and unchanged bytes encode as [1][1][x] per byte pair,
+// plus a trailing [zero run][0]
+#define REWIND_WORST_CASE   ((u16)(3 * ((sizeof(GameSnapshot) + 1) / 2) + 2))
+
+void initRewind(){
+    // Zero both images so struct padding never shows up as a change
+    memset(&rewind_state, 0, sizeof(rewind_state));
+    memset(&rewind_scratch, 0, sizeof(rewind_scratch));
+    rec_first = 0;
+    rec_count = 0;
+    bytes_used = 0;
+    bytes_head = 0;
+    rewind_timer = 0;
+    rewind_valid = FALSE;
+}
+
+static void dropOldestRecord(){
+    bytes_used -= rec_len[rec_first];
+    rec_first = (rec_first + 1) & (REWIND_RECORDS - 1);
+    rec_count -= 1;
+}
+
+#define putByte(b)  { rewind_bytes[pos & (REWIND_BYTES - 1)] = (b); pos++; }
+
+// Encode newer ^ older into the ring at bytes_head, returns the encoded length
+static u16 encodeDelta(const u8* newer, const u8* older){
+    u16 pos = bytes_head;
+    u16 i = 0;
+    const u16 n = sizeof(GameSnapshot);
+
+    while (i < n){
+        u16 zeros = 0;
+        while (i < n && zeros < 255 && newer[i] == older[i]) { i++; zeros++; }
+
+        u16 lit_start = i;
+        u16 lits = 0;
+        while (i < n && lits < 255 && newer[i] != older[i]) { i++; lits++; }
+
+        putByte(zeros);
+        putByte(lits);
+        for (u16 k = 0; k < lits; k++) {
+            putByte(newer[lit_start + k] ^ older[lit_start + k]);
+        }
+    }
+    return pos - bytes_head;
+}
+
+// XOR a record back into the snapshot image
+static void applyDelta(u8* image, u16 start, u16 len){
+    u16 pos = start;
+    u16 end = start + len;
+    u16 i = 0;
+
+    while (pos != end){
+        i += rewind_bytes[pos & (REWIND_BYTES - 1)]; pos++;
+        u16 lits = rewind_bytes[pos & (REWIND_BYTES - 1)]; pos++;
+        while (lits--) {
+            image[i++] ^= rewind_bytes[pos & (REWIND_BYTES - 1)]; pos++;
+        }
+    }
+}
+
+void recordRewind(){
+    rewind_timer += 1;
+    if (rewind_timer < REWIND_INTERVAL) return;
+    rewind_timer = 0;
+
+    saveSnapshot(&rewind_scratch);
+    if (rewind_valid){
+        while (rec_count > 0 && (rec_count == REWIND_RECORDS || REWIND_BYTES - bytes_used < REWIND_WORST_CASE)){
+            dropOldestRecord();
+        }
+
+        u16 r = (rec_first + rec_count) & (REWIND_RECORDS - 1);
+        rec_start[r] = bytes_head;
+        rec_len[r] = encodeDelta((const u8*)&rewind_scratch, (const u8*)&rewind_state);
+        bytes_head += rec_len[r];
+        bytes_used += rec_len[r];
+        rec_count += 1;
+    }
+    memcpy(&rewind_state, &rewind_scratch, sizeof(GameSnapshot));
+    rewind_valid = TRUE;
+}
+
+u16 rewindState(u16 steps){
+    if (!rewind_valid) return 0;
+
+    u16 done = 0;
+    while (done < steps && rec_count > 0){
+        u16 r = (rec_first + rec_count - 1) & (REWIND_RECORDS - 1);
+        applyDelta((u8*)&rewind_state, rec_start[r], rec_len[r]);
+        bytes_head -= rec_len[r];
+        bytes_used -= rec_len[r];
+        rec_count -= 1;
+        done += 1;
+    }
+
+    loadSnapshot(&rewind_state);
+    rewind_timer = 0;
+    return done;
+}
@@ -2,146 +2,206 @@
 #include <genesis.h>
 #include "globals.h" 
 #include "spaceMines.h"
+#include "game_events.h"
+#include "visibility.h"
+#include "collision.h"
+#include "anim.h"
+#include "sprite_atlas.h"
+#include "world.h"
 #include "resources.h" 
 
+static void mineArmed(u16 m);
 
-void placeMine(){
-	if (mine_status == 0){
-		mine_status = 1;
-		mine_x = player_x;
-		mine_y = player_y;
-		mine_timer = 0; // Arm the space mine timer.
-		mine_sprite_ptr = SPR_addSprite(&space_mine_res,
-                                            mine_x, mine_y, TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
-		SPR_setFrame(mine_sprite_ptr, 0);
-	}
+// space_mine_res: frame 0 while arming, then the armed frame is held
+static const u8 mine_arm_durations[2] = { MINE_ARM_FRAMES, ANIM_HOLD };
+static const AnimDef mine_arm_anim = { mine_arm_durations, MINE_ARMED_FRAME + 1, FALSE, mineArmed };
 
-}
+// Coarse bucket grid over the MAPSIZE window around the camera.  Each cell holds a bitmask of the armed
+// mines whose (expanded) box overlaps it, so a fighter or the player only tests the
+// mines in its own cell.  Only the cells written this frame are cleared again.
+static u8 mine_grid[MINE_GRID_DIM * MINE_GRID_DIM];
+static u16 mine_grid_used[NMINE_MAX * 4];
+static u16 mine_grid_used_count = 0;
 
-void updateMine(){
+static u16 mineGridCell(s16 x, s16 y){
+    u16 cx = ((x + MAPSIZED2) >> MINE_GRID_SHIFT) & (MINE_GRID_DIM - 1);
+    u16 cy = ((y + MAPSIZED2) >> MINE_GRID_SHIFT) & (MINE_GRID_DIM - 1);
+    return cy * MINE_GRID_DIM + cx;
+}
 
-	if (mine_status > 0){
-		mine_x += -player_scroll_delta_x; // Adjust for map scroll
-	    mine_y += -player_scroll_delta_y; // Adjust for map scroll
+static void mineGridMark(s16 x, s16 y, u8 bit){
+    u16 cell = mineGridCell(x, y);
+    if (mine_grid[cell] == 0){
+        mine_grid_used[mine_grid_used_count++] = cell;
+    }
+    mine_grid[cell] |= bit;
+}
 
-	    if (mine_x >  MAPSIZED2) mine_x -= MAPSIZE;
-        if (mine_x < MMAPSIZED2) mine_x += MAPSIZE; // Ensure positive if wrapped
-        if (mine_y >  MAPSIZED2) mine_y -= MAPSIZE;
-        if (mine_y < MMAPSIZED2) mine_y += MAPSIZE;
+// The player's boxes reach furthest from its top-left corner, and the expanded box below has
+// to fit in one cell for its four corners to cover it
+#if FIGHTER_SPRITE_HIT_MAX > PLAYER_SPRITE_HIT_MAX
+#error "MINE_GRID_REACH assumes the player's hitboxes are the largest"
+#endif
+#if 2 * MINE_GRID_REACH > (1 << MINE_GRID_SHIFT)
+#error "MINE_GRID_REACH is larger than half a mine grid cell"
+#endif
+
+// Insert armed mines.  Boxes are expanded by MINE_GRID_REACH so a test on the
+// top-left corner of a fighter or the player finds every mine whose trigger box it can touch.
+static void buildMineGrid(){
+    for (u16 k = 0; k < mine_grid_used_count; k++) {
+        mine_grid[mine_grid_used[k]] = 0;
+    }
+    mine_grid_used_count = 0;
+
+    for (s16 m = 0; m < NMINE_MAX; m++) {
+        if (mines[m].status > 1 &&
+            mines[m].x >= MMAPSIZED2 && mines[m].x <= MAPSIZED2 &&
+            mines[m].y >= MMAPSIZED2 && mines[m].y <= MAPSIZED2){ // Outside the window nothing can reach it
+            s16 x1 = mines[m].x - MINE_GRID_REACH;
+            s16 y1 = mines[m].y - MINE_GRID_REACH;
+            s16 x2 = mines[m].x + MINE_GRID_REACH - 1;
+            s16 y2 = mines[m].y + MINE_GRID_REACH - 1;
+            u8 bit = 1 << m;
+
+            // The expanded box is smaller than a cell, so its corners cover every cell it touches
+            mineGridMark(x1, y1, bit);
+            mineGridMark(x2, y1, bit);
+            mineGridMark(x1, y2, bit);
+            mineGridMark(x2, y2, bit);
+        }
+    }
+}
 
+// Armed mines go off when a ship's tight box comes within MINE_TRIGGER_MARGIN of the mine's
+static u16 mineTriggered(s16 m, const SpriteHitboxes* ship, u16 frame, s16 x, s16 y){
+    const Hitbox* hm = &space_mine_hit.boxes[MINE_ARMED_FRAME];
+    const Hitbox* hs = &ship->boxes[frame];
+    return boxOverlap(mines[m].x + hm->x - MINE_TRIGGER_MARGIN, mines[m].y + hm->y - MINE_TRIGGER_MARGIN,
+                      hm->w + 2 * MINE_TRIGGER_MARGIN, hm->h + 2 * MINE_TRIGGER_MARGIN,
+                      x + hs->x, y + hs->y, hs->w, hs->h);
+}
 
-	    if (mine_x > -8 && mine_x < screen_width_pixels &&
-            mine_y > -8 && mine_y < screen_height_pixels) {
-            SPR_setPosition(mine_sprite_ptr, mine_x, mine_y);
-            SPR_setVisibility(mine_sprite_ptr, VISIBLE);
-        } else {
-            SPR_setVisibility(mine_sprite_ptr, HIDDEN); // Hide if off-screen
-        }
-	    
-	    if (mine_timer < mine_timer_max){
-	    	mine_timer += 1;
-	    } else if (mine_timer == mine_timer_max) {
-	    	mine_status = 2; // Arm the space mine
-	    	SPR_setFrame(mine_sprite_ptr, 1);
-	    	mine_timer = mine_timer_max + 1;
-	    }
-
-	} else if (mine_status < -1){
-
-		mine_x += -player_scroll_delta_x; // Adjust for map scroll
-	    mine_y += -player_scroll_delta_y; // Adjust for map scroll
-
-	    if (mine_x >  MAPSIZED2) mine_x -= MAPSIZE;
-        if (mine_x < MMAPSIZED2) mine_x += MAPSIZE; // Ensure positive if wrapped
-        if (mine_y >  MAPSIZED2) mine_y -= MAPSIZE;
-        if (mine_y < MMAPSIZED2) mine_y += MAPSIZE;
-
-	    if ((mine_status == -9) & (mexplode_status == 0)){
-	    	
-	    	mexplode_sprite_ptr = SPR_addSprite(&mine_explode_res,
-                                    mine_x,	mine_y,	TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
-	 		SPR_setFrame(mexplode_sprite_ptr, 0);
-            mexplode_status = 5;
-
-	    } else if ((mine_status == -2) & (mexplode_status == 0)){ // Remove sprite
-            
-            SPR_releaseSprite(mexplode_sprite_ptr);
-            mexplode_sprite_ptr = NULL;
-            mine_status = -1;
-        
-        } else if (mexplode_status == 0) {  // Advance frame
-            
-            SPR_setFrame(mexplode_sprite_ptr, mine_status + 9);
-            mexplode_status = 5;
-        
-        }
+void initMines(){
+    for (s16 m = 0; m < NMINE_MAX; m++) {
+        mines[m].status = 0; // No mine is placed
+        mines[m].anim = -1;
+        mines[m].sprite_ptr = NULL;
+    }
+    for (u16 k = 0; k < MINE_GRID_DIM * MINE_GRID_DIM; k++) {
+        mine_grid[k] = 0;
+    }
+    mine_grid_used_count = 0;
+    new_mine_delay_timer = MINE_PLACE_DELAY;
+}
 
-        if (mexplode_status > 0){ 
-        	if (mine_x > -8 && mine_x < screen_width_pixels &&
-	            mine_y > -8 && mine_y < screen_height_pixels) {
-	            SPR_setPosition(mexplode_sprite_ptr, mine_x, mine_y);
-	            SPR_setVisibility(mexplode_sprite_ptr, VISIBLE);
-	        } else {
-	            SPR_setVisibility(mexplode_sprite_ptr, HIDDEN); // Hide if off-screen
-	        }
+// Arming animation finished (the sprite is already on MINE_ARMED_FRAME)
+static void mineArmed(u16 m){
+	if (mines[m].sprite_ptr) SPR_setFrame(mines[m].sprite_ptr, MINE_ARMED_FRAME);
+	mines[m].status = 2;
+	mines[m].anim = -1;
+}
 
-            mexplode_status -= 1;
-        }
-        
-        if (mexplode_status == 0){
-            mine_status += 1;
-        }
+void placeMine(){
+	if (new_mine_delay_timer < MINE_PLACE_DELAY) return; // This timer is incremented in handleInput
 
+	s16 placed = 0;
+	s16 free_slot = -1;
+	for (s16 m = 0; m < NMINE_MAX; m++) {
+		if (mines[m].status != 0) placed += 1;
+		else if (free_slot < 0) free_slot = m;
 	}
+	if (placed >= mine_cap || free_slot < 0) return; // Level cap reached
+
+	Mine* mine = &mines[free_slot];
+	mine->status = 1;
+	mine->x = player_x;
+	mine->y = player_y;
+	anchorAt(&mine->wx, &camera_x, mine->x);
+	anchorAt(&mine->wy, &camera_y, mine->y);
+	mine->sprite_ptr = addAtlasSprite(&space_mine_res,
+                                        mine->x, mine->y, TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
+	mine->anim = startAnim(&mine_arm_anim, &mine->sprite_ptr, free_slot); // Arms when it completes
+	if (mine->anim < 0) mineArmed(free_slot);
+	new_mine_delay_timer = 0;
+}
 
+void updateMine(){
 
-	if (mine_status > 1){ // If mine is armed, check for collisions
+	for (s16 m = 0; m < NMINE_MAX; m++) {
+		Mine* mine = &mines[m];
 
-		for (s16 i = 0; i < active_fighter_count; i++) {
+		if (mine->status > 0){
+			mine->x = localFromAnchor(&mine->wx, &camera_x); // Camera already moved this tick
+			mine->y = localFromAnchor(&mine->wy, &camera_y);
+		}
+	}
+
+	buildMineGrid();
+	if (mine_grid_used_count == 0) return; // No armed mines
+
+	for (s16 i = 0; i < active_fighter_count; i++) {
 
-			if (fighters[i].status >= 0) { // only explode alive fighters
+		if (fighters[i].status >= 0) { // only explode alive fighters
 
-				if (fighters[i].x     < mine_x + 16 && // fighter left < bullet right
-	                fighters[i].x + 8 > mine_x     && // fighter right > bullet left
-	                fighters[i].y     < mine_y + 16 && // fighter top < bullet bottom
-	                fighters[i].y + 8 > mine_y)       // fighter bottom > bullet top
+			u8 mask = mine_grid[mineGridCell(fighters[i].x, fighters[i].y)];
+			for (s16 m = 0; mask; m++, mask >>= 1) {
+				if ((mask & 1) && mines[m].status > 1 &&
+					mineTriggered(m, &fighter_sprite_hit, FIGHTER_FRAME, fighters[i].x, fighters[i].y))
 	            {
 	            	fighters[i].status = -9; // Deactivate fighter (-9 means we do an explosion)
-	                if(fighters[i].sprite_ptr) SPR_releaseSprite(fighters[i].sprite_ptr);
-	                fighters[i].sprite_ptr = NULL;
-
-	            	mine_status = -9; // Deactivate mine (-9 means we do an explosion)
-	            	mexplode_status = 0;
-		            if(mine_sprite_ptr) SPR_releaseSprite(mine_sprite_ptr);
-		            mine_sprite_ptr = NULL;
-		            player_score += 5;
-		            if (player_score > 100){
-		            	player_score = 100;
-		            }
-		            game_score += 20;
-		            XGM2_playPCMEx(sfx_mexplode, sizeof(sfx_mexplode), SOUND_PCM_CH3, 4, FALSE, FALSE);
-
-		            break; // Once an explosion happens, stop loop.
+	            	mines[m].status = -9;    // Deactivate mine (-9 means we do an explosion)
+		            pushGameEvent(EVT_MINE_DETONATE, CAUSE_MINE, i, m); // Score, sound and explosions
+		            break; // A fighter can only set off one mine
 	            }
-	        }
-
+			}
 		}
+	}
 
-		if (mine_x     < player_x + 16 && // fighter left < bullet right
-            mine_x + 8 > player_x      && // fighter right > bullet left
-            mine_y     < player_y + 16 && // fighter top < bullet bottom
-            mine_y + 8 > player_y)       // fighter bottom > bullet top
+	u8 mask = mine_grid[mineGridCell(player_x, player_y)];
+	for (s16 m = 0; mask; m++, mask >>= 1) {
+		if ((mask & 1) && mines[m].status > 1 &&
+			mineTriggered(m, &player_sprite_hit, player_rotation_index, player_x, player_y))
         {
-        	mine_status = -9; // Deactivate mine (-9 means we do an explosion)
-        	mexplode_status = 0;
-            if(mine_sprite_ptr) SPR_releaseSprite(mine_sprite_ptr);
-            mine_sprite_ptr = NULL;
-            player_score -= 10;
-            if (player_score < 0){
-            	player_score = 0;
-            }
-            XGM2_playPCMEx(sfx_mexplode, sizeof(sfx_mexplode), SOUND_PCM_CH2, 4, FALSE, FALSE);
+        	mines[m].status = -9; // Deactivate mine (-9 means we do an explosion)
+            pushGameEvent(EVT_MINE_DETONATE, CAUSE_MINE, -1, m); // Player loses points
         }
 	}
 
-}
\ No newline at end of file
+}
+
+// Called after updateVisibility
+void drawMines(){
+	for (s16 m = 0; m < NMINE_MAX; m++) {
+		if (mines[m].status > 0){
+			if (VIS_TEST(mine_visible, m)) {
+	            SPR_setPosition(mines[m].sprite_ptr, mines[m].x, mines[m].y);
+	            SPR_setVisibility(mines[m].sprite_ptr, VISIBLE);
+	        } else {
+	            SPR_setVisibility(mines[m].sprite_ptr, HIDDEN); // Hide if off-screen
+	        }
+		}
+	}
+}
+
+// After a snapshot restore: placed mines get their sprites back
+void respawnMineSprites(){
+	for (s16 m = 0; m < NMINE_MAX; m++) {
+		mines[m].sprite_ptr = NULL;
+		if (mines[m].status > 0){
+			mines[m].sprite_ptr = addAtlasSprite(&space_mine_res,
+                                        mines[m].x, mines[m].y, TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
+			SPR_setFrame(mines[m].sprite_ptr, (mines[m].status > 1) ? MINE_ARMED_FRAME : 0);
+		}
+	}
+}
+
+void clearMines(){
+	for (s16 m = 0; m < NMINE_MAX; m++) {
+		stopAnim(mines[m].anim);
+		mines[m].anim = -1;
+		if (mines[m].sprite_ptr) SPR_releaseSprite(mines[m].sprite_ptr);
+		mines[m].sprite_ptr = NULL;
+		mines[m].status = 0;
+	}
+}
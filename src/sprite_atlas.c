@@ -0,0 +1,77 @@
+// sprite_atlas.c
+#include <genesis.h>
+#include "globals.h"
+#include "sprite_atlas.h"
+#include "resources.h"
+
+static const SpriteDefinition* const atlas_sheets[] = {
+    &player_sprite_res,     // 24 rotations, the one that used to upload on every turn
+    &fighter_sprite_res,
+    &bullet_sprite_res,
+    &sbullet_sprite_res,
+    &ebullet_sprite_res,
+    &fighter_explode_res,
+    &mine_explode_res,
+    &space_mine_res,
+};
+#define ATLAS_SHEETS (sizeof(atlas_sheets) / sizeof(atlas_sheets[0]))
+
+static u16** atlas_indexes[ATLAS_SHEETS];   // [animation][frame] -> VRAM tile, from SPR_loadAllFrames
+static u16 atlas_base;                      // First atlas tile
+
+static s16 atlasSheet(const SpriteDefinition* def){
+    for (u16 k = 0; k < ATLAS_SHEETS; k++) {
+        if (atlas_sheets[k] == def) return k;
+    }
+    return -1;
+}
+
+// Tiles SPR_loadAllFrames will use for a sheet (every frame, no sharing)
+static u16 sheetTiles(const SpriteDefinition* def){
+    u16 n = 0;
+    for (u16 a = 0; a < def->numAnimation; a++) {
+        const Animation* anim = def->animations[a];
+        for (u16 f = 0; f < anim->numFrame; f++) {
+            n += anim->frames[f]->tileset->numTile;
+        }
+    }
+    return n;
+}
+
+// Frame change: point the sprite at the frame's tiles instead of uploading them
+static void atlasFrameChanged(Sprite* sprite){
+    s16 k = atlasSheet(sprite->definition);
+    SPR_setVRAMTileIndex(sprite, atlas_indexes[k][sprite->animInd][sprite->frameInd]);
+}
+
+void initSpriteAtlas(){
+    u16 total = 0;
+    for (u16 k = 0; k < ATLAS_SHEETS; k++) {
+        total += sheetTiles(atlas_sheets[k]);
+    }
+
+    atlas_base = TILE_FONT_INDEX - SPRITE_ENGINE_TILES - total;
+    u16 index = atlas_base;
+    for (u16 k = 0; k < ATLAS_SHEETS; k++) {
+        u16 used;
+        atlas_indexes[k] = SPR_loadAllFrames(atlas_sheets[k], index, &used);
+        index += used;
+    }
+}
+
+void checkBelowAtlas(u16 end, const char* what){
+    if (end > atlas_base) SYS_die((char*) what);
+}
+
+Sprite* addAtlasSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attribut){
+    s16 k = atlasSheet(def);
+    if (k < 0) return SPR_addSprite(def, x, y, attribut); // Not in the atlas: engine-managed tiles
+
+    // No VRAM allocation or tile upload; the sprite only ever points into the atlas
+    Sprite* sprite = SPR_addSpriteEx(def, x, y, attribut,
+                                     SPR_FLAG_AUTO_VISIBILITY | SPR_FLAG_AUTO_SPRITE_ALLOC);
+    if (sprite == NULL) return NULL;
+    SPR_setVRAMTileIndex(sprite, atlas_indexes[k][0][0]);
+    SPR_setFrameChangeCallback(sprite, atlasFrameChanged);
+    return sprite;
+}
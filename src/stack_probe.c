@@ -0,0 +1,25 @@
+// stack_probe.c
+#include <genesis.h>
+#include "globals.h"
+#include "stack_probe.h"
+
+static u16* paint_top;      // First painted word (just below paintStack's frame)
+static u16* paint_bottom;
+
+void paintStack(){
+    volatile u16 marker;    // Its address is the current stack depth
+
+    // Leave paintStack's own frame (and an interrupt frame) alone
+    paint_top = (u16*)(((u32)&marker - STACK_PROBE_SKIP) & ~1);
+    paint_bottom = paint_top - STACK_PROBE_BYTES / 2;
+
+    for (u16* p = paint_bottom; p < paint_top; p++) {
+        *p = STACK_PAINT;
+    }
+}
+
+u16 stackHighWater(){
+    u16* p = paint_bottom;
+    while (p < paint_top && *p == STACK_PAINT) p++;
+    return (paint_top - p) * 2;
+}
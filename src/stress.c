@@ -0,0 +1,180 @@
+// stress.c
+#include <genesis.h>
+#include "globals.h"
+#include "stress.h"
+#include "controls.h"
+#include "bullets.h"
+#include "ebullets.h"
+#include "sbullets.h"
+#include "bullet_pool.h"
+#include "fighters.h"
+#include "explosions.h"
+#include "spaceMines.h"
+#include "stack_probe.h"
+
+static const char* const scenario_names[STRESS_COUNT + 1] = {
+    "none", "fighters", "bullets", "explosions", "boost_wrap", "mine_crowd"
+};
+
+static const char* const section_names[STRESS_SECTIONS] = {
+    "player", "collide", "bullets", "mines", "fighters", "explosions",
+    "draw", "ebullets", "events", "scroll", "present"
+};
+
+// Held buttons for each scenario (rotate style)
+static const u16 scenario_input[STRESS_COUNT + 1] = {
+    0,
+    0,                                      // Fighters close in on an idle player
+    BUTTON_B | BUTTON_C | BUTTON_LEFT,      // Spin and fire both guns
+    0,
+    BUTTON_UP | BUTTON_A,                   // Thrust and boost whenever it recharges
+    0
+};
+
+static u32 section_total[STRESS_SECTIONS];
+static u16 section_max[STRESS_SECTIONS];
+static u16 frame_hist[STRESS_HIST_BINS];
+static u16 frame_overruns;      // Frames over STRESS_BUDGET
+static u16 frame_worst;
+static u32 frame_start;
+static u32 mark_last;
+static u16 stress_frame;
+
+// A point fully on screen below the HUD, size px from the edges
+static void randomOnScreen(s16* x, s16* y, s16 size){
+    *x = random() % (screen_width_pixels - size);
+    *y = HUD_WINDOW_ROWS * 8 + random() % (screen_height_pixels - HUD_WINDOW_ROWS * 8 - size);
+}
+
+static void fightersOnScreen(void){
+    for (s16 i = 0; i < active_fighter_count; i++) {
+        if (fighters[i].status >= 0) randomOnScreen(&fighters[i].x, &fighters[i].y, 16);
+    }
+}
+
+// Regroup the live fighters around STRESS_CROWD_X/Y and fill every mine slot in the middle
+static void mineCrowd(void){
+    for (s16 i = 0; i < active_fighter_count; i++) {
+        if (fighters[i].status >= 0){
+            fighters[i].x = STRESS_CROWD_X - 48 + random() % 96;
+            fighters[i].y = STRESS_CROWD_Y - 48 + random() % 96;
+        }
+    }
+
+    s16 px = player_x, py = player_y;  // placeMine drops at the player
+    for (s16 m = 0; m < NMINE_MAX; m++) {
+        player_x = STRESS_CROWD_X - 16 + (m & 1) * 32;
+        player_y = STRESS_CROWD_Y - 16 + (m >> 1) * 32;
+        new_mine_delay_timer = MINE_PLACE_DELAY;
+        placeMine();
+    }
+    player_x = px; player_y = py;
+}
+
+void stressSetup(){
+    setRandomSeed(STRESS_SEED);
+
+    bindControlStyle(CONTROL_ROTATE);  // Scripted input is written for this style
+    score_to_win = 0xFFFF;             // No level_up mid-run
+    efire_cooldown_timer = efire_cooldown_timer_min;
+    active_fighter_count = NFIGHTER_MAX;
+    applyLevelPoolSizes();
+    mine_cap = NMINE_MAX;
+
+    // Same entry points as a new game; no sprites exist yet, so nothing needs releasing
+    initBullets();
+    init_SBullets();
+    initFighters();
+    initExplosions();
+    initMines();
+    init_eBullets();
+    initFighterFire();
+
+    if (STRESS_SCENARIO == STRESS_FIGHTERS || STRESS_SCENARIO == STRESS_BULLETS){
+        fightersOnScreen();
+    }
+    if (STRESS_SCENARIO == STRESS_BOOST_WRAP){
+        player_rotation_index = SINCOS_TABLE_STEPS / 8; // Diagonal, so both axes wrap
+    }
+
+    memset(section_total, 0, sizeof(section_total));
+    memset(section_max, 0, sizeof(section_max));
+    memset(frame_hist, 0, sizeof(frame_hist));
+    frame_overruns = 0;
+    frame_worst = 0;
+    stress_frame = 0;
+}
+
+void stressBegin(){
+    u16 value = scenario_input[STRESS_SCENARIO];
+    joy_pressed  = value & ~joy_held;
+    joy_released = joy_held & ~value;
+    joy_held     = value;
+
+    if (STRESS_SCENARIO == STRESS_EXPLOSIONS){
+        s16 x, y;
+        do {
+            randomOnScreen(&x, &y, explosionSize(EXPLOSION_MINE));
+        } while (spawnExplosion(random() & 1, x, y) >= 0);
+    }
+    if (STRESS_SCENARIO == STRESS_MINE_CROWD && (stress_frame % STRESS_CROWD_PERIOD) == 0){
+        mineCrowd();
+    }
+
+    frame_start = getSubTick();
+    mark_last = frame_start;
+}
+
+void stressMark(u16 section){
+    u32 now = getSubTick();
+    u16 t = now - mark_last;
+    section_total[section] += t;
+    if (t > section_max[section]) section_max[section] = t;
+    mark_last = now;
+}
+
+static void logRow(const char* tag, const char* name, u32 a, u32 b){
+    char line[64];
+    char num[12];
+    strcpy(line, tag);
+    strcat(line, ",");
+    strcat(line, scenario_names[STRESS_SCENARIO]);
+    strcat(line, ",");
+    strcat(line, name);
+    uintToStr(a, num, 1); strcat(line, ","); strcat(line, num);
+    uintToStr(b, num, 1); strcat(line, ","); strcat(line, num);
+    KLog(line);
+}
+
+void stressEnd(){
+    u32 t = getSubTick() - frame_start;
+    u16 bin = t / STRESS_HIST_BIN;
+    frame_hist[(bin < STRESS_HIST_BINS) ? bin : STRESS_HIST_BINS - 1] += 1;
+    if (t > STRESS_BUDGET) frame_overruns += 1;
+    if (t > frame_worst) frame_worst = t;
+
+    if (++stress_frame < STRESS_FRAMES) return;
+
+    // tag,scenario,name,a,b
+    KLog("section,scenario,name,total_subticks,max_subticks");
+    for (u16 s = 0; s < STRESS_SECTIONS; s++) {
+        logRow("section", section_names[s], section_total[s], section_max[s]);
+    }
+    KLog("hist,scenario,name,bin_start_subticks,frames");
+    for (u16 b = 0; b < STRESS_HIST_BINS; b++) {
+        logRow("hist", "frame", b * STRESS_HIST_BIN, frame_hist[b]);
+    }
+    KLog("budget,scenario,name,budget_subticks,overruns");
+    logRow("budget", "frame", STRESS_BUDGET, frame_overruns);
+    logRow("worst", "frame", frame_worst, 0);
+    KLog("pace,scenario,name,dropped_total,streak_max");
+    logRow("pace", "vblank", frame_drops_total, frame_drop_streak_max);
+    KLog("stack,scenario,name,used_bytes,painted_bytes");
+    logRow("stack", "main", stackHighWater(), STACK_PROBE_BYTES);
+    logRow("done", "frames", STRESS_FRAMES, STRESS_SEED);
+
+    VDP_drawText("Stress done", 15, 13);
+    while (1) {
+        SYS_doVBlankProcess();
+    }
+}
@@ -0,0 +1,34 @@
+// timestep.c
+#include <genesis.h>
+#include "globals.h"
+#include "timestep.h"
+
+static u16 refresh_hz;      // Vblanks per second: 60 NTSC, 50 PAL
+static u16 tick_acc;        // SIM_HZ units owed to the simulation
+static u32 step_vtimer;     // vtimer when ticks were last handed out
+
+void initTimestep(){
+    refresh_hz = SYS_isPAL() ? 50 : 60;
+    resyncTimestep();
+}
+
+void resyncTimestep(){
+    tick_acc = 0;
+    step_vtimer = vtimer;
+}
+
+u16 timestepTicks(){
+    u32 now = vtimer;
+    u16 elapsed = now - step_vtimer;
+    step_vtimer = now;
+
+    tick_acc += SIM_HZ * ((elapsed > SIM_MAX_TICKS) ? SIM_MAX_TICKS : elapsed);
+
+    u16 ticks = 0;
+    while (tick_acc >= refresh_hz && ticks < SIM_MAX_TICKS) {
+        tick_acc -= refresh_hz;
+        ticks += 1;
+    }
+    if (tick_acc >= refresh_hz) tick_acc = 0; // Over the cap: let the game slow down instead of spiralling
+    return (ticks > 0) ? ticks : 1; // Right after a resync no vblank has passed yet
+}
@@ -3,22 +3,27 @@
 #include "globals.h" // For Fighter struct, fighters array, player_x/y, map constants, screen_width_pixels etc.
 #include "resources.h" 
 #include "title_screen.h"
+#include "palette_fx.h"
+#include "controls.h"
+#include "input.h"
+#include "save.h"
+#include "sprite_atlas.h"
 
 
-u16 button_delay = 30;
-u16 fcounter_l = 0;
-u16 fcounter_r = 0;
+u16 button_delay = 31; // Auto-repeat period while left/right is held
 
 u16 level_pos = 23;
 
-u16 pal_count  = 0;
-u16 pal_change = 35; // how often to change palette 
-u16 pal_to_use = 0;
+// Title colour cycling: alternate 36 and 60 frame holds
+static const Palette* const title_pal_keys[4] = { &title_pal_1, &title_pal_2, &title_pal_3, &title_pal_4 };
+static const u16 title_pal_durations[4] = { 36, 60, 36, 60 };
+static const PaletteCycle title_pal_cycle = { title_pal_keys, title_pal_durations, 4 };
 
 void title_screen(){
 
-    PAL_setPalette(PAL3, title_pal_1.data, DMA_QUEUE);
+    startPaletteCycle(PAL3, &title_pal_cycle);
 
+    checkBelowAtlas(ind + title.tileset->numTile, "Title tiles overlap the sprite atlas");
     VDP_drawImageEx(BG_B, &title, TILE_ATTR_FULL(PAL3, FALSE, FALSE, FALSE, ind), 0, 0, FALSE, TRUE);
 
 	// VDP_drawText("  Ready?  ", 15, 13);
@@ -27,83 +32,43 @@ void title_screen(){
     // intToStr(game_level, text_vel_x, 2);
     // VDP_drawText(" Level:   ", 15, level_pos);
     // VDP_drawText(text_vel_x  , 22, level_pos);
-    if (control_style == 0){
-        VDP_drawTextBGFill(BG_A, "Control R", 15, level_pos, 8); //Rotational style
-    } else {
-        VDP_drawTextBGFill(BG_A, "Control D", 15, level_pos, 8); //Directional style
-    }
+    VDP_drawTextBGFill(BG_A, control_styles[control_style].name, 15, level_pos, 8);
+
+    VDP_drawText("Hi", 15, level_pos + 2);
+    intToStr(high_score, text_vel_x, 5);
+    VDP_drawText(text_vel_x, 18, level_pos + 2);
 
     // Start music
     XGM2_setLoopNumber(-1);
     XGM2_play(title_music);
     XGM2_setFMVolume(75);
 
-    fcounter_l = 0;
-    fcounter_r = 0;
-
-    u16 value_old = JOY_readJoypad(JOY_1);
-
     while(1){
 
-        pal_count += 1;
-        if (pal_count > pal_change){
-            pal_to_use = (pal_to_use + 1)%4;
-            pal_count = 0;
-            if (pal_change == 35){
-                pal_change = 59;
-            } else {
-                pal_change = 35;
-            }
-        }
-        
-        if (pal_to_use == 0){
-            PAL_setPalette(PAL3, title_pal_1.data, DMA_QUEUE);
-        } else if (pal_to_use == 1){
-            PAL_setPalette(PAL3, title_pal_2.data, DMA_QUEUE);
-        } else if (pal_to_use == 2){
-            PAL_setPalette(PAL3, title_pal_3.data, DMA_QUEUE);
-        } else if (pal_to_use == 3){
-            PAL_setPalette(PAL3, title_pal_4.data, DMA_QUEUE);
-        }
-        
-        u16 value = JOY_readJoypad(JOY_1);
-
-        if (value != value_old){
-        	value_old = value;
-        	fcounter_l = 0;
-        	fcounter_r = 0;
-        }
+        updateInput();
 
-        if (value & BUTTON_START) {
+        if (STRESS_SCENARIO || (joy_held & BUTTON_START)) {
             break;  // Let's start the game.
         }
 
-        if (value & BUTTON_LEFT){
-        	if (fcounter_l == 0){
-	        	// game_level -= 1;
-	        	// if (game_level < 1){
-	        	// 	game_level = 1;
-	        	// }
-                control_style -= 1;
-                if (control_style < 0){
-                    control_style = 1;
-                }
-	        	fcounter_l = 1;
-	        }
-        }
-
-        if (value & BUTTON_RIGHT){
-        	if (fcounter_r == 0){
-	        	// game_level += 1;
-	        	// if (game_level > 10){
-	        	// 	game_level = 10;
-	        	// }
-                control_style += 1;
-                if (control_style > 1){
-                    control_style = 0;
-                }
-	        	fcounter_r = 1;
-	        }
+        if (inputRepeat(BUTTON_LEFT, button_delay)){
+        	// game_level -= 1;
+        	// if (game_level < 1){
+        	// 	game_level = 1;
+        	// }
+            control_style -= 1;
+            if (control_style < 0){
+                control_style = CONTROL_STYLE_COUNT - 1;
+            }
+        } else if (inputRepeat(BUTTON_RIGHT, button_delay)){
+        	// game_level += 1;
+        	// if (game_level > 10){
+        	// 	game_level = 10;
+        	// }
+            control_style += 1;
+            if (control_style >= CONTROL_STYLE_COUNT){
+                control_style = 0;
+            }
         }
 
         // if (game_level != game_level_old){
@@ -115,38 +80,25 @@ void title_screen(){
         // }
         if (control_style != control_style_old){
             control_style_old = control_style;
-            if (control_style == 0){
-                VDP_drawTextBGFill(BG_A, "Control R", 15, level_pos, 8); //Rotational style
-                boost_factor = 5;
-            } else {
-                VDP_drawTextBGFill(BG_A, "Control D", 15, level_pos, 8); //Directional style
-                boost_factor = 2; 
-            }
+            VDP_drawTextBGFill(BG_A, control_styles[control_style].name, 15, level_pos, 8);
+            inputResponse(BUTTON_LEFT | BUTTON_RIGHT);
         }
 
-        
-        if (fcounter_l > button_delay){
-        	fcounter_l = 0;
-        }
-        if (fcounter_l > 0){
-        	fcounter_l += 1;
-        }
-
-        if (fcounter_r > button_delay){
-        	fcounter_r = 0;
-        }
-        if (fcounter_r > 0){
-        	fcounter_r += 1;
-        }
 
+        updatePaletteFx(); // Uploads PAL3 only on frames the cycle changes key
         SPR_update();
         SYS_doVBlankProcess();
     }
 
+    stopPaletteCycle(PAL3);
+    bindControlStyle(control_style); // handleInput calls this style's handler from now on
+    saveProgress();                  // Keep the chosen style (writes only if it changed)
+
     // VDP_clearText(15, 13, DEBUG_TEXT_LEN + 6);
     // VDP_clearText(15, 14, DEBUG_TEXT_LEN + 6);
     VDP_clearText(15, level_pos, DEBUG_TEXT_LEN + 6);
-    game_level_old = 0; // Reset to allow screen updates
+    VDP_clearText(15, level_pos + 2, DEBUG_TEXT_LEN + 6);
+    hud_dirty = HUD_DIRTY_ALL; // Reset to allow screen updates
     efire_cooldown_timer = 4 * (5 - game_level);
     if (efire_cooldown_timer > 16){
         efire_cooldown_timer = 16;
@@ -168,12 +120,8 @@ void title_screen(){
 // Set up scoring and level details
 void init_game_vars(){
 	player_score = 0;
-    player_score_old = 1;
-
     fighters_score = 0;
-    fighters_score_old = 1;
-
     game_level = 1;
-    game_level_old = 0;
     score_to_win = 100;
+    hud_dirty = HUD_DIRTY_ALL;
 }
@@ -0,0 +1,49 @@
+// visibility.c
+#include <genesis.h>
+#include "globals.h" // For fighters, mines, explosions, screen size
+#include "visibility.h"
+#include "explosions.h"
+
+// Lowest set bit of a nibble (0 is never looked up)
+static const u8 low_bit[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+// Same test the draw code used everywhere: allow a sprite's width of overlap at the top/left
+static inline u16 onScreen(s16 x, s16 y, s16 size){
+    return x > -size && x < screen_width_pixels &&
+           y > -size && y < screen_height_pixels;
+}
+
+void updateVisibility(){
+    u32 f = 0;
+    for (s16 i = 0; i < active_fighter_count; i++) {
+        if (fighters[i].status >= 0 && onScreen(fighters[i].x, fighters[i].y, 8)) f |= (u32)1 << i;
+    }
+    fighter_visible = f;
+
+    u8 m = 0;
+    for (s16 i = 0; i < NMINE_MAX; i++) {
+        if (mines[i].status > 0 && onScreen(mines[i].x, mines[i].y, 8)) m |= 1 << i;
+    }
+    mine_visible = m;
+
+    u8 e = 0;
+    for (s16 i = 0; i < EXPLOSION_MAX; i++) {
+        if (explosions[i].anim >= 0 &&
+            onScreen(explosions[i].x, explosions[i].y, explosionSize(explosions[i].kind))) e |= 1 << i;
+    }
+    explosion_visible = e;
+}
+
+s16 visNext(u32* mask){
+    u32 m = *mask;
+    if (m == 0) return -1;
+
+    s16 bit = 0;
+    if ((m & 0xFFFF) == 0) { m >>= 16; bit += 16; }
+    if ((m & 0xFF) == 0)   { m >>= 8;  bit += 8;  }
+    if ((m & 0xF) == 0)    { m >>= 4;  bit += 4;  }
+    bit += low_bit[m & 0xF];
+
+    *mask &= *mask - 1; // Clear the bit just returned
+    return bit;
+}
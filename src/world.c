@@ -0,0 +1,48 @@
+// world.c
+#include <genesis.h>
+#include "globals.h"
+#include "world.h"
+
+// Only a crossing of the offset range touches the sector index; the level wraps at SECTOR_COUNT
+static void stepAxis(WorldAxis* a, s16 d){
+    a->offset += d;
+    while (a->offset >= SECTOR_SIZE) {
+        a->offset -= SECTOR_SIZE;
+        a->sector = (a->sector + 1) & SECTOR_MASK;
+    }
+    while (a->offset < 0) {
+        a->offset += SECTOR_SIZE;
+        a->sector = (a->sector - 1) & SECTOR_MASK;
+    }
+}
+
+void initCamera(){
+    camera_x.sector = 0; camera_x.offset = 0;
+    camera_y.sector = 0; camera_y.offset = 0;
+}
+
+// Entities on screen move by -player_scroll_delta, so the camera moves by +player_scroll_delta
+void advanceCamera(){
+    stepAxis(&camera_x, player_scroll_delta_x);
+    stepAxis(&camera_y, player_scroll_delta_y);
+}
+
+void anchorAt(WorldAxis* a, const WorldAxis* cam, s16 local){
+    *a = *cam;
+    stepAxis(a, local);
+}
+
+s16 localFromAnchor(const WorldAxis* a, const WorldAxis* cam){
+    // Nearest sector distance in [-SECTOR_COUNT/2, SECTOR_COUNT/2)
+    s16 ds = ((a->sector - cam->sector + SECTOR_COUNT / 2) & SECTOR_MASK) - SECTOR_COUNT / 2;
+    if (ds > SECTOR_REACH || ds < -SECTOR_REACH) return SECTOR_PARKED;
+
+    s16 local = (ds << SECTOR_SHIFT) + (a->offset - cam->offset);
+#if SECTOR_COUNT == 1
+    WRAP_WINDOW(local);     // The level is the window itself
+#elif SECTOR_COUNT == 2
+    if (local > SECTOR_SIZE) local -= 2 * SECTOR_SIZE;     // Nearest copy of a two-sector level
+    else if (local < -SECTOR_SIZE) local += 2 * SECTOR_SIZE;
+#endif
+    return local;
+}
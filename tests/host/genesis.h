@@ -0,0 +1,42 @@
+// genesis.h (host tests)
+// Just enough of SGDK's types and declarations for the game modules built on the host.
+// Sprites are opaque; the SGDK functions a test links against are stubbed in the test.
+#ifndef HOST_GENESIS_H
+#define HOST_GENESIS_H
+
+#include <stddef.h>
+#include <stdlib.h>     // abs (maths.h on the console)
+#include <string.h>     // memcpy, memset
+
+typedef signed char     s8;
+typedef unsigned char   u8;
+typedef short           s16;
+typedef unsigned short  u16;
+typedef int             s32;
+typedef unsigned int    u32;
+
+#ifndef TRUE
+#define TRUE    1
+#define FALSE   0
+#endif
+
+#define TILE_USER_INDEX 0x10
+#define VISIBLE         1
+
+typedef struct Sprite Sprite;
+
+// SGDK's random() returns u16; keep it apart from the libc one in stdlib.h
+#define random  sgdkRandom
+u16 random(void);
+void setRandomSeed(u16 seed);
+
+void SPR_setVisibility(Sprite* sprite, u16 value);
+
+// Cartridge SRAM, file-backed on the host (sram.c, sram.h)
+void SRAM_enable(void);
+void SRAM_enableRO(void);
+void SRAM_disable(void);
+u8 SRAM_readByte(u32 offset);
+void SRAM_writeByte(u32 offset, u8 value);
+
+#endif // HOST_GENESIS_H
@@ -0,0 +1,2 @@
+// maths.h (host tests)
+#include "genesis.h"
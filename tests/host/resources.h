@@ -0,0 +1,2 @@
+// resources.h (host tests)
+// Stands in for the rescomp output; the modules built on the host use no resources.
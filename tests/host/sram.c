@@ -0,0 +1,63 @@
+// sram.c (host tests)
+// SGDK's SRAM_* calls over a memory-mapped file.  Writes only land while SRAM is enabled
+// read-write, and hostSramCutPower drops them after a set count, like a reset mid-write.
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "sram.h"
+
+static u8* sram = NULL;
+static u16 sram_mode;       // 0 off, 1 read-only, 2 read-write
+static s32 writes_left = -1;
+
+void hostSramOpen(const char* path){
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0 || ftruncate(fd, HOST_SRAM_BYTES) != 0){
+        perror(path);
+        exit(2);
+    }
+    if (sram) munmap(sram, HOST_SRAM_BYTES);
+    sram = mmap(NULL, HOST_SRAM_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (sram == MAP_FAILED){
+        perror(path);
+        exit(2);
+    }
+    sram_mode = 0;
+    writes_left = -1;
+}
+
+void hostSramErase(void){
+    memset(sram, 0xFF, HOST_SRAM_BYTES);
+}
+
+void hostSramCorrupt(u32 offset){
+    sram[offset] ^= 0xFF;
+}
+
+void hostSramCutPower(s32 writes){
+    writes_left = writes;
+}
+
+void SRAM_enable(void){
+    sram_mode = 2;
+}
+
+void SRAM_enableRO(void){
+    sram_mode = 1;
+}
+
+void SRAM_disable(void){
+    sram_mode = 0;
+}
+
+u8 SRAM_readByte(u32 offset){
+    return (sram_mode && offset < HOST_SRAM_BYTES) ? sram[offset] : 0xFF;
+}
+
+void SRAM_writeByte(u32 offset, u8 value){
+    if (sram_mode != 2 || offset >= HOST_SRAM_BYTES || writes_left == 0) return;
+    if (writes_left > 0) writes_left--;
+    sram[offset] = value;
+}
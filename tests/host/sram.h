@@ -0,0 +1,16 @@
+// sram.h (host tests)
+// Test controls for the file-backed SRAM in sram.c.  The file is mapped, so every
+// SRAM_writeByte lands in it at once, as on the cartridge.
+#ifndef HOST_SRAM_H
+#define HOST_SRAM_H
+
+#include "genesis.h"
+
+#define HOST_SRAM_BYTES 0x8000
+
+void hostSramOpen(const char* path);    // Map the file, created blank when missing
+void hostSramErase(void);               // Blank (0xFF) like a new battery
+void hostSramCorrupt(u32 offset);       // Flip every bit of one byte
+void hostSramCutPower(s32 writes);      // Drop every write after this many more (-1 = never)
+
+#endif // HOST_SRAM_H
@@ -0,0 +1,131 @@
+// test_collision.c
+// Host tests for collision.c: fast movers must not tunnel, slow movers use the end position.
+#include <stdio.h>
+#include <genesis.h>
+#include "constants.h"
+#include "collision.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// 2x2 bullet stepping 20 px across an 8x8 box: both end points are clear of it
+static void testFastBulletCrossesBox(void){
+    CHECK(isFastMover(20, 0, 2, 2));
+    CHECK(!boxOverlap(0, 3, 2, 2, 8, 0, 8, 8));     // Start
+    CHECK(!boxOverlap(20, 3, 2, 2, 8, 0, 8, 8));    // End
+    CHECK(sweptBoxHit(0, 3, 2, 2, 20, 0, 8, 0, 8, 8));
+
+    // Same crossing right to left and vertically
+    CHECK(sweptBoxHit(20, 3, 2, 2, -20, 0, 8, 0, 8, 8));
+    CHECK(sweptBoxHit(11, -10, 2, 2, 0, 20, 8, 0, 8, 8));
+
+    // A step that stops short of the box
+    CHECK(!sweptBoxHit(0, 3, 2, 2, 5, 0, 8, 0, 8, 8));
+}
+
+// Boosted player (frame 0) passes a fighter within one frame's step
+static void testBoostedPlayerPassesFighter(void){
+    CHECK(!spriteHit(&player_sprite_hit, 0, 0, 0, &fighter_sprite_hit, FIGHTER_FRAME, 20, 0));
+    CHECK(!spriteHit(&player_sprite_hit, 0, 40, 0, &fighter_sprite_hit, FIGHTER_FRAME, 20, 0));
+    CHECK(spriteSweptHit(&player_sprite_hit, 0, 0, 0, 40, 0, &fighter_sprite_hit, FIGHTER_FRAME, 20, 0));
+
+    // Fighter well below the path
+    CHECK(!spriteSweptHit(&player_sprite_hit, 0, 0, 0, 40, 0, &fighter_sprite_hit, FIGHTER_FRAME, 20, 30));
+}
+
+// Boost held at a scroll boundary: player_x stays put and the fighters scroll afterwards,
+// so in the fighters' frame the move runs forward from player_x (collideFighters)
+static void testBoostAtScrollBoundary(void){
+    s16 px = 200, v = 24;
+
+    // Held at the boundary: scroll delta is the whole step
+    s16 start = sweepStart(px, v, v);
+    CHECK(start == px);
+    CHECK(spriteSweptHit(&player_sprite_hit, 0, start, 0, v, 0, &fighter_sprite_hit, FIGHTER_FRAME, 216, 0));
+
+    // The previous tick's segment [px - v, px] must not be what gets tested
+    CHECK(!spriteSweptHit(&player_sprite_hit, 0, px - v, 0, v, 0, &fighter_sprite_hit, FIGHTER_FRAME, 216, 0));
+
+    // Fighter already behind the player: the forward sweep does not reach back for it
+    CHECK(!spriteSweptHit(&player_sprite_hit, 0, start, 0, v, 0, &fighter_sprite_hit, FIGHTER_FRAME, 180, 0));
+
+    // Free movement inside the boundary: no scroll, player_x already holds the end position
+    start = sweepStart(px, v, 0);
+    CHECK(start == px - v);
+    CHECK(spriteSweptHit(&player_sprite_hit, 0, start, 0, v, 0, &fighter_sprite_hit, FIGHTER_FRAME, 190, 0));
+}
+
+// Diagonal move that passes close to a box corner without touching, and edges that only touch
+static void testGrazingMiss(void){
+    // The broad phase box overlaps, the slabs' entry/exit times do not
+    CHECK(boxOverlap(0, 0, 22, 22, 12, 2, 4, 4));
+    CHECK(!sweptBoxHit(0, 0, 2, 2, 20, 20, 12, 2, 4, 4));
+    CHECK(!sweptBoxHit(0, 0, 2, 2, 20, 20, 2, 12, 4, 4));
+
+    // Sliding along an edge: touching edges do not hit, one pixel deeper does
+    CHECK(!sweptBoxHit(0, 0, 4, 4, 20, 0, 10, 4, 4, 4));
+    CHECK(sweptBoxHit(0, 1, 4, 4, 20, 0, 10, 4, 4, 4));
+
+    // Ending exactly against the far side's near edge
+    CHECK(!sweptBoxHit(0, 0, 2, 2, 8, 0, 10, 0, 4, 4));
+}
+
+// Movers under half their box per frame take the plain end-position test
+static void testSlowMoversUseEndPosition(void){
+    CHECK(!isFastMover(3, 0, 8, 8));
+    CHECK(!isFastMover(4, -4, 8, 8));
+    CHECK(isFastMover(5, 0, 8, 8));
+
+    // Ends overlapping: hit
+    CHECK(sweptBoxHit(0, 0, 8, 8, 3, 0, 9, 0, 8, 8));
+
+    // Starts overlapping but ends clear: no hit, only the end position counts
+    CHECK(boxOverlap(6, 0, 8, 8, 0, 0, 8, 8));
+    CHECK(!sweptBoxHit(6, 0, 8, 8, 3, 0, 0, 0, 8, 8));
+
+    // Slow sprites are tested with the masks at the end position
+    CHECK(spriteSweptHit(&fighter_sprite_hit, FIGHTER_FRAME, 0, 0, 1, 0, &fighter_sprite_hit, FIGHTER_FRAME, 5, 0) ==
+          spriteHit(&fighter_sprite_hit, FIGHTER_FRAME, 1, 0, &fighter_sprite_hit, FIGHTER_FRAME, 5, 0));
+    CHECK(!spriteSweptHit(&fighter_sprite_hit, FIGHTER_FRAME, 0, 0, 1, 0, &fighter_sprite_hit, FIGHTER_FRAME, 8, 0));
+}
+
+// Every ship position whose box touches an armed mine's trigger box (the test in spaceMines.c)
+// lies within MINE_GRID_REACH of the mine, where buildMineGrid marks it
+static void mineReachCovers(const SpriteHitboxes* ship){
+    const Hitbox* hm = &space_mine_hit.boxes[MINE_ARMED_FRAME];
+    for (u16 f = 0; f < ship->num_frames; f++) {
+        const Hitbox* hs = &ship->boxes[f];
+        for (s16 y = -32; y <= 32; y++) {
+            for (s16 x = -32; x <= 32; x++) {
+                if (boxOverlap(hm->x - MINE_TRIGGER_MARGIN, hm->y - MINE_TRIGGER_MARGIN,
+                               hm->w + 2 * MINE_TRIGGER_MARGIN, hm->h + 2 * MINE_TRIGGER_MARGIN,
+                               x + hs->x, y + hs->y, hs->w, hs->h)){
+                    CHECK(x >= -MINE_GRID_REACH && x < MINE_GRID_REACH);
+                    CHECK(y >= -MINE_GRID_REACH && y < MINE_GRID_REACH);
+                }
+            }
+        }
+    }
+}
+
+static void testMineGridReach(void){
+    mineReachCovers(&player_sprite_hit);
+    mineReachCovers(&fighter_sprite_hit);
+}
+
+int main(void){
+    testFastBulletCrossesBox();
+    testBoostedPlayerPassesFighter();
+    testBoostAtScrollBoundary();
+    testGrazingMiss();
+    testSlowMoversUseEndPosition();
+    testMineGridReach();
+
+    if (failures) {
+        printf("test_collision: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("test_collision: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,181 @@
+// test_cyclerun.c
+// End-to-end test for tools/cyclerun: writes small hand-assembled ROMs and symbol files,
+// runs the harness on them and checks the frame and per-function cycle counts it reports.
+//
+//   test_cyclerun <path to cyclerun>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static unsigned char rom[0x400];
+static const char* cyclerun;
+
+static void put16(unsigned addr, unsigned v) { rom[addr] = v >> 8; rom[addr + 1] = v; }
+static void put32(unsigned addr, unsigned v) { put16(addr, v >> 16); put16(addr + 2, v); }
+
+// _start: loop { bsr begin; bsr work; bsr end }; work spins a 100-pass DBF loop.
+// From entry of begin to entry of end: rts 16 + bsr 18 + move 8 + 99 * dbf 10 + dbf 14
+// + rts 16 + bsr 18 = 1080 cycles, of which work (move to rts) is 1028.
+#define FRAME_CYCLES    1080
+#define WORK_CYCLES     1028
+
+static void save(const char* name, const char* syms){
+    char path[64];
+    snprintf(path, sizeof(path), "%s.bin", name);
+    FILE* f = fopen(path, "wb");
+    fwrite(rom, 1, sizeof(rom), f);
+    fclose(f);
+
+    snprintf(path, sizeof(path), "%s.sym", name);
+    f = fopen(path, "w");
+    fputs(syms, f);
+    fclose(f);
+    memset(rom, 0, sizeof(rom));
+}
+
+static void writeCountRom(void){
+    put32(0x000, 0xFFFF00);         // SSP
+    put32(0x004, 0x000200);         // PC
+    put16(0x200, 0x46FC); put16(0x202, 0x2700);     // move #$2700,sr
+    put16(0x204, 0x6100); put16(0x206, 0x007A);     // bsr.w begin
+    put16(0x208, 0x6100); put16(0x20A, 0x0086);     // bsr.w work
+    put16(0x20C, 0x6100); put16(0x20E, 0x0092);     // bsr.w end
+    put16(0x210, 0x60F2);                           // bra.s 204
+    put16(0x280, 0x4E75);                           // begin: rts
+    put16(0x290, 0x303C); put16(0x292, 99);         // work: move.w #99,d0
+    put16(0x294, 0x51C8); put16(0x296, 0xFFFE);     //       dbf d0,*
+    put16(0x298, 0x4E75);                           //       rts
+    put16(0x2A0, 0x4E75);                           // end: rts
+    save("count", "00000200 T _start\n00000280 T begin\n00000290 T work\n000002a0 T end\n00ff0000 B ram\n");
+}
+
+// Same loop paced by VINT: after end it waits for the handler to set a RAM flag.  work
+// spins loops * 18 cycles; the third call of end logs "done,vint" on the KDebug port.
+static void writeVintRom(const char* name, unsigned loops){
+    static const char done[] = "done,vint";
+    put32(0x000, 0xFFFF00);
+    put32(0x004, 0x000200);
+    put32(0x078, 0x0003C0);                         // Level 6 autovector
+    put16(0x200, 0x46FC); put16(0x202, 0x2700);     // move #$2700,sr
+    put16(0x204, 0x33FC); put16(0x206, 0x8174); put32(0x208, 0xC00004);  // VDP reg 1: display, VINT
+    put16(0x20C, 0x33FC); put16(0x20E, 3); put32(0x210, 0xFF0000);       // move.w #3,frames
+    put16(0x214, 0x46FC); put16(0x216, 0x2000);     // move #$2000,sr
+    put16(0x218, 0x6100); put16(0x21A, 0x00E6);     // bsr.w begin
+    put16(0x21C, 0x6100); put16(0x21E, 0x00F2);     // bsr.w work
+    put16(0x220, 0x6100); put16(0x222, 0x010E);     // bsr.w end
+    put16(0x224, 0x4A79); put32(0x226, 0xFF0002);   // tst.w vflag
+    put16(0x22A, 0x67F8);                           // beq.s 224
+    put16(0x22C, 0x4279); put32(0x22E, 0xFF0002);   // clr.w vflag
+    put16(0x232, 0x60E4);                           // bra.s 218
+    put16(0x300, 0x4E75);                           // begin: rts
+    put16(0x310, 0x203C); put32(0x312, loops);      // work: move.l #loops,d0
+    put16(0x316, 0x5380);                           //       subq.l #1,d0
+    put16(0x318, 0x66FC);                           //       bne.s 316
+    put16(0x31A, 0x4E75);                           //       rts
+    put16(0x330, 0x5379); put32(0x332, 0xFF0000);   // end: subq.w #1,frames
+    put16(0x336, 0x6702);                           //      beq.s 33A
+    put16(0x338, 0x4E75);                           //      rts
+    unsigned a = 0x33A;
+    for (unsigned i = 0; i < sizeof(done); i++, a += 8) {     // Ends with 0x9E00: flush the line
+        put16(a, 0x33FC); put16(a + 2, 0x9E00 | (unsigned char)done[i]); put32(a + 4, 0xC00004);
+    }
+    put16(a, 0x60FE);                               //      bra.s *
+    put16(0x3C0, 0x33FC); put16(0x3C2, 1); put32(0x3C4, 0xFF0002);       // vint: move.w #1,vflag
+    put16(0x3C8, 0x4E73);                           //       rte
+    save(name, "00000200 T _start\n00000300 T begin\n00000310 T work\n00000330 T end\n000003c0 T vint\n");
+}
+
+static int run(const char* name, const char* extra){
+    char cmd[1024];
+    snprintf(cmd, sizeof(cmd), "\"%s\" %s.bin --sym %s.sym --frame-begin begin --frame-end end "
+             "--func work --csv %s.csv %s > %s.out", cyclerun, name, name, name, extra, name);
+    int status = system(cmd);
+    return status == -1 ? -1 : (status >> 8) & 0xFF;
+}
+
+static int outputHas(const char* name, const char* text){
+    char path[64], line[256];
+    snprintf(path, sizeof(path), "%s.out", name);
+    FILE* f = fopen(path, "r");
+    int found = 0;
+    if (!f) return 0;
+    while (!found && fgets(line, sizeof(line), f)) found = strstr(line, text) != NULL;
+    fclose(f);
+    return found;
+}
+
+static void testCounts(void){
+    CHECK(run("count", "--frames 5") == 0);
+
+    FILE* f = fopen("count.csv", "r");
+    CHECK(f != NULL);
+    if (!f) return;
+
+    char line[256];
+    int frames = 0, work_found = 0, work_self = 0;
+    while (fgets(line, sizeof(line), f)) {
+        unsigned idx, cycles, missed;
+        char name[64];
+        double calls, avg;
+        unsigned long long a, b;
+        unsigned max, n;
+        if (sscanf(line, "frame,%u,%u,%u", &idx, &cycles, &missed) == 3){
+            CHECK(cycles == FRAME_CYCLES && missed == 0);
+            frames++;
+        } else if (sscanf(line, "func,%63[^,],%lf,%lf,%u", name, &calls, &avg, &max) == 4){
+            CHECK(strcmp(name, "work") == 0 && calls == 1.0 && avg == WORK_CYCLES && max == WORK_CYCLES);
+            work_found = 1;
+        } else if (sscanf(line, "symbol,%63[^,],%llu,%llu,%u", name, &a, &b, &n) == 4 && strcmp(name, "work") == 0){
+            CHECK(a == 5 * WORK_CYCLES && b == 5 * WORK_CYCLES && n == 5);
+            work_self = 1;
+        }
+    }
+    fclose(f);
+    CHECK(frames == 5);
+    CHECK(work_found && work_self);
+}
+
+static void testBudget(void){
+    CHECK(run("count", "--frames 5 --budget 1079") == 1);
+    CHECK(run("count", "--frames 5 --budget 1079 --max-overruns 5") == 0);
+    CHECK(run("count", "--frames 5 --budget 1080") == 0);
+}
+
+// Runs to the "done," log line; frames that run past the next vblank are overruns
+static void testVblank(void){
+    writeVintRom("vint_fits", 100);
+    CHECK(run("vint_fits", "") == 0);
+    CHECK(outputHas("vint_fits", "klog: done,vint"));
+    CHECK(outputHas("vint_fits", "frames: 3 measured"));
+
+    writeVintRom("vint_slow", 8000);        // 144000 cycles of work
+    CHECK(run("vint_slow", "") == 1);
+    CHECK(outputHas("vint_slow", "0 over budget") == 0);
+    CHECK(outputHas("vint_slow", "3 past their vblank"));
+    CHECK(run("vint_slow", "--max-overruns 3") == 0);
+
+    CHECK(run("vint_fits", "--frame-end nosuchsymbol") == 2);
+}
+
+int main(int argc, char** argv){
+    if (argc != 2){
+        printf("usage: test_cyclerun <cyclerun>\n");
+        return 2;
+    }
+    cyclerun = argv[1];
+    writeCountRom();
+    testCounts();
+    testBudget();
+    testVblank();
+
+    if (failures) {
+        printf("test_cyclerun: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("test_cyclerun: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,116 @@
+// test_save.c
+// Host test for save.c over the file-backed SRAM in tests/host/sram.c: slot choice, torn
+// writes and the wrapping sequence number.  A "power cycle" resets the globals to their
+// boot values and runs loadSave on whatever the file holds.
+#include <stdio.h>
+#include <genesis.h>
+#include "globals.h"
+#include "save.h"
+#include "controls.h"
+#include "sram.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+#define WRITES_PER_SAVE (2 + 10 + 2)   // Checksum cleared, body, checksum
+
+static void powerCycle(void){
+    high_score = 0;
+    best_level = 1;
+    control_style = CONTROL_DIRECT;
+    game_score = 0;
+    game_level = 1;
+    loadSave();
+}
+
+static void saveScore(u16 score){
+    game_score = score;
+    saveProgress();
+}
+
+static void testBlank(void){
+    hostSramErase();
+    powerCycle();
+    CHECK(high_score == 0 && best_level == 1 && control_style == CONTROL_DIRECT);
+
+    saveScore(1200);
+    powerCycle();
+    CHECK(high_score == 1200);
+}
+
+// The newest slot failing its checksum falls back to the older one, and the next save
+// goes over the bad slot rather than the good one
+static void testCorruptNewest(void){
+    hostSramErase();
+    powerCycle();
+    saveScore(100);                             // Slot 0
+    saveScore(200);                             // Slot 1
+    hostSramCorrupt(SAVE_SLOT_BYTES + 4);       // Slot 1 high_score
+    powerCycle();
+    CHECK(high_score == 100);
+
+    saveScore(300);
+    powerCycle();
+    CHECK(high_score == 300);
+    hostSramCorrupt(SAVE_SLOT_BYTES + 4);
+    powerCycle();
+    CHECK(high_score == 100);                   // Slot 0 was left alone
+}
+
+// Power lost after any number of writes: the record only counts once its checksum is
+// complete, until then the previous one loads
+static void testTornWrite(void){
+    for (s32 cut = 0; cut <= WRITES_PER_SAVE; cut++) {
+        hostSramErase();
+        powerCycle();
+        saveScore(500);
+        saveScore(600);
+        powerCycle();
+
+        hostSramCutPower(cut);
+        saveScore(700);
+        hostSramCutPower(-1);
+        powerCycle();
+        CHECK(high_score == (cut < WRITES_PER_SAVE ? 600 : 700));
+    }
+
+    // Torn first write on blank SRAM: still blank
+    hostSramErase();
+    powerCycle();
+    hostSramCutPower(WRITES_PER_SAVE - 1);
+    saveScore(800);
+    hostSramCutPower(-1);
+    powerCycle();
+    CHECK(high_score == 0);
+}
+
+// The u16 sequence wraps; the slot written last still wins across 0xFFFF -> 0
+static void testSequenceWrap(void){
+    hostSramErase();
+    powerCycle();
+    u16 ok = 1;
+    for (u32 n = 0; n < 0x10000 + 4 && ok; n++) {
+        control_style = (n & 1) ? CONTROL_DIRECT : CONTROL_ROTATE;
+        s16 saved = control_style;
+        saveProgress();
+        powerCycle();
+        ok = control_style == saved;
+    }
+    CHECK(ok);
+}
+
+int main(int argc, char** argv){
+    hostSramOpen(argc > 1 ? argv[1] : "test_save.sram");
+    testBlank();
+    testCorruptNewest();
+    testTornWrite();
+    testSequenceWrap();
+
+    if (failures) {
+        printf("test_save: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("test_save: all checks passed\n");
+    return 0;
+}
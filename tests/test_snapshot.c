@@ -0,0 +1,141 @@
+// test_snapshot.c
+// Host test for the rewind ring in snapshot.c: record snapshot deltas, rewind, and compare
+// the restored globals against images saved when each snapshot was taken.
+#include <stdio.h>
+#include <genesis.h>
+#include "globals.h"
+#include "snapshot.h"
+#include "clear_sprites.h"
+#include "ebullets.h"
+#include "spaceMines.h"
+#include "explosions.h"
+#include "shield.h"
+#include "anim.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// --- SGDK and sprite stubs (loadSnapshot only rebuilds sprites) ---
+
+static u16 seed = 1;
+
+u16 random(void){ seed = seed * 25173 + 13849; return seed; }
+void setRandomSeed(u16 s){ seed = s; }
+void SPR_setVisibility(Sprite* sprite, u16 value){ (void)sprite; (void)value; }
+void clear_sprites(void){}
+void rebuildFighterFire(void){}
+void respawnMineSprites(void){}
+void respawnExplosionSprites(void){}
+void restoreShieldFx(void){}
+void refreshAnims(void){}
+
+#define STEPS   24
+
+static GameSnapshot expected[STEPS];
+
+// XOR a pattern into every every-th byte.  every = 2 is the RLE worst case.
+static u8 pattern;
+static u16 every;
+
+static void mutate(void* v, u16 size){
+    u8* p = (u8*)v;
+    for (u16 i = 0; i < size; i += every) p[i] ^= pattern;
+}
+
+#define MUTATE(v)   mutate(&v, sizeof(v));
+
+// Restoring flags live bullets and fighters for a sprite re-add; set those flags up front
+// so a restored state reads back exactly as it was saved
+static void flagNew(Bullet* items, u16 size){
+    for (u16 i = 0; i < size; i++) {
+        if (items[i].status >= 0) items[i].new_bullet = 1;
+    }
+}
+
+static void normalize(u16 step){
+    active_fighter_count = step % NFIGHTER_MAX;
+    flagNew(bullets, NBULLET);
+    flagNew(ebullets, NEBULLET);
+    flagNew(sbullets, NSBULLET);
+    for (s16 i = 0; i < active_fighter_count; i++) fighters[i].new_fighter = 1;
+}
+
+// The state as a snapshot, without the reseed value (saving draws a new one)
+static void capture(GameSnapshot* s){
+    memset(s, 0, sizeof(*s));
+    saveSnapshot(s);
+    s->rng_seed = 0;
+}
+
+// Take STEPS snapshots, changing the state before each: every big_every-th step changes
+// every other byte, the others every small_every-th byte of each global
+static void recordSteps(u16 big_every, u16 small_every){
+    initRewind();
+    for (u16 step = 0; step < STEPS; step++) {
+        pattern = (u8)(0x5A + step * 7) | 1;
+        every = (step % big_every == big_every - 1) ? 2 : small_every;
+        SNAPSHOT_FIELDS(MUTATE)
+        normalize(step);
+        for (u16 t = 0; t < REWIND_INTERVAL; t++) recordRewind();
+        capture(&expected[step]);
+    }
+}
+
+// Rewind one snapshot at a time as far as the ring goes, checking each restored state
+static u16 rewindAll(void){
+    GameSnapshot now;
+    u16 back = 0;
+    while (rewindState(1) == 1){
+        back++;
+        capture(&now);
+        CHECK(memcmp(&now, &expected[STEPS - 1 - back], sizeof(now)) == 0);
+    }
+    return back;
+}
+
+// Records of every other byte changed are ~1.5x the snapshot.  Mixed with small ones they
+// arrive at every fill level of the ring, which has to drop the oldest records first
+// rather than let the new one overwrite them.
+static void testWorstCaseDeltas(void){
+    for (u16 big_every = 1; big_every <= 6; big_every++) {
+        recordSteps(big_every, 97);
+        u16 back = rewindAll();
+        CHECK(back >= 1);
+        CHECK(back < STEPS - 1);
+    }
+}
+
+// Small deltas fit many records; rewinding goes all the way back to the first snapshot
+static void testSmallDeltas(void){
+    recordSteps(STEPS + 1, 1000);
+    CHECK(rewindAll() == STEPS - 1);
+}
+
+// Recording after a partial rewind continues from the restored state
+static void testRecordAfterRewind(void){
+    recordSteps(STEPS + 1, 1000);
+    CHECK(rewindState(4) == 4);
+    GameSnapshot restored;
+    capture(&restored);
+    CHECK(memcmp(&restored, &expected[STEPS - 5], sizeof(restored)) == 0);
+
+    game_nframe += 1;
+    for (u16 t = 0; t < REWIND_INTERVAL; t++) recordRewind();
+    CHECK(rewindState(1) == 1);
+    capture(&restored);
+    CHECK(memcmp(&restored, &expected[STEPS - 5], sizeof(restored)) == 0);
+}
+
+int main(void){
+    testWorstCaseDeltas();
+    testSmallDeltas();
+    testRecordAfterRewind();
+
+    if (failures) {
+        printf("test_snapshot: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("test_snapshot: all checks passed\n");
+    return 0;
+}
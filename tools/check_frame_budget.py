@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# check_frame_budget.py
+#
+# Gate on the report a STRESS_SCENARIO build prints to the KDebug log (see stress.h).
+# The log can be emulator output with other text around the CSV rows.
+#
+#   check_frame_budget.py <log> [--max-overruns N] [--section-max NAME=SUBTICKS ...]
+#
+# Prints the per-section table and histogram for every scenario found, then exits 1 if
+# a scenario went over STRESS_BUDGET on more than N frames (default 0), a section's
+# worst frame is above its limit, or the log holds no finished run.
+
+import argparse
+import re
+import sys
+
+ROW_RE = re.compile(r'(section|hist|budget|worst|pace|stack|done),(\w+),(\w+),(\d+),(\d+)')
+
+
+def parse(path):
+    runs = {}
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = ROW_RE.search(line)
+            if not m:
+                continue
+            tag, scenario, name, a, b = m.groups()
+            run = runs.setdefault(scenario, {'section': [], 'hist': [], 'budget': None,
+                                             'worst': None, 'pace': None,
+                                             'stack': None, 'done': None})
+            if tag in ('section', 'hist'):
+                run[tag].append((name, int(a), int(b)))
+            else:
+                run[tag] = (int(a), int(b))
+    return runs
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Check stress scenario frame budgets')
+    ap.add_argument('log')
+    ap.add_argument('--max-overruns', type=int, default=0)
+    ap.add_argument('--section-max', action='append', default=[], metavar='NAME=SUBTICKS')
+    args = ap.parse_args()
+
+    limits = {}
+    for item in args.section_max:
+        name, _, value = item.partition('=')
+        limits[name] = int(value)
+
+    runs = parse(args.log)
+    failed = False
+    finished = 0
+
+    for scenario, run in sorted(runs.items()):
+        if run['done'] is None:
+            print('%s: incomplete run' % scenario)
+            failed = True
+            continue
+        finished += 1
+        frames = run['done'][0]
+        print('%s (%d frames)' % (scenario, frames))
+        for name, total, worst in run['section']:
+            mark = ''
+            if name in limits and worst > limits[name]:
+                mark = '  OVER %d' % limits[name]
+                failed = True
+            print('  %-12s avg %6d  max %6d%s' % (name, total // max(frames, 1), worst, mark))
+        for _, start, count in run['hist']:
+            if count:
+                print('  frame >= %5d: %d' % (start, count))
+        if run['budget'] is not None:
+            budget, overruns = run['budget']
+            worst = run['worst'][0] if run['worst'] else 0
+            print('  budget %d, worst %d, overruns %d' % (budget, worst, overruns))
+            if overruns > args.max_overruns:
+                failed = True
+        if run['pace'] is not None:
+            print('  dropped vblanks %d, longest streak %d' % run['pace'])
+        if run['stack'] is not None:
+            print('  stack used %d of %d painted' % run['stack'])
+
+    if finished == 0:
+        print('%s: no finished stress run' % args.log)
+        failed = True
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,926 @@
+// cyclerun.c
+// Cycle harness: runs a ROM (out.bin) on the Musashi 68000 core with the Mega Drive around
+// it stubbed, and reports per-frame and per-function CPU cycles using the nm symbol file.
+//
+//   cyclerun <rom.bin> --sym <rom.sym> [options]
+//
+//   --frame-begin SYM   Frame starts when execution reaches SYM (default stressBegin)
+//   --frame-end SYM     Frame ends when execution reaches SYM (default stressEnd)
+//   --func SYM          Report SYM's inclusive cycles per frame (repeatable)
+//   --frames N          Stop after N measured frames (default: run until a "done," log line)
+//   --skip N            Frames run before measuring starts (default 0)
+//   --budget CYCLES     Frame budget (default one video frame: 128005 NTSC, 152917 PAL)
+//   --max-overruns N    Frames allowed over budget or past their vblank (default 0)
+//   --top N             Symbols listed by self cycles (default 20)
+//   --csv FILE          Per-frame, per-function and per-symbol rows for scripts
+//   --pal               PAL timing and version register
+//   --z80-ready A:M     OR mask M into reads of Z80 RAM address A, so the 68k sees the
+//                       sound driver as ready; default 0x102:0x80 (SGDK Z80_DRV_STATUS);
+//                       "none" disables
+//   --stall-frames N    Fail when no frame completes for N video frames (default 600)
+//
+// KDebug output (KLog, VDP register 30) is echoed to stdout prefixed with "klog: ", so
+// check_frame_budget.py can read it; a line starting "done," ends the run.  KDebug timer
+// writes (register 31) print the cycles between start and stop.
+//
+// Timing model: Musashi's 68000 instruction times with no wait states (MULU/MULS and
+// DIVU/DIVS take fixed times); the video timing (lines, vblank, VINT/HINT, HV counter,
+// status flags) runs off the same clock.  68k to
+// VDP DMA freezes the CPU for an estimate of the transfer time (about 5 cycles per word in
+// vblank, 54 in active display); VDP FIFO waits and the Z80 taking the bus are not
+// modelled.  Frame times run from entry of --frame-begin to entry of --frame-end, and
+// self/inclusive symbol times only count cycles inside measured frames.  Tail calls
+// (JMP into another function) count toward the caller's inclusive time.
+//
+// Musashi has no call or exception hooks.  Calls and returns are read off the previous
+// instruction (BSR/JSR, RTS/RTR/RTE) at the next instruction hook, interrupts off the
+// acknowledge callback, and a CPU fault off the PC arriving at the handler of vectors 2-11
+// (except trace) from the ROM's vector table.
+//
+// Exit status: 0 within budget, 1 over budget / incomplete / CPU fault, 2 usage errors.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68k.h"         // Musashi, configured by m68kconf.h in this directory
+
+#define MCLK_PER_LINE       3420
+#define MCLK_PER_CYCLE      7
+#define HBLANK_MCLK         2920    // Line position where the HBLANK status flag rises
+#define DMA_MCLK_VBLANK     24      // Master clocks per word of 68k DMA, blanking (~205 B/line)
+#define DMA_MCLK_ACTIVE     380     // Same during active display (~18 B/line)
+#define ROM_MAX             (4 * 1024 * 1024)
+#define SRAM_BASE           0x200000
+#define SRAM_SIZE           0x10000
+#define MAX_FUNCS           32
+#define MAX_DEPTH           256
+#define MAX_Z80_READY       8
+#define LOG_LINE_MAX        256
+
+typedef struct {
+    uint32_t addr;
+    char* name;
+    uint64_t self;
+    uint64_t incl;
+    uint32_t calls;
+    int active;                 // Frames of this symbol on the shadow stack
+} Symbol;
+
+typedef struct {
+    int sym;
+    uint32_t sp;
+    uint64_t entry;
+} Frame;
+
+typedef struct {
+    const char* name;
+    int sym;
+    uint64_t frame_incl;        // This frame
+    uint32_t frame_calls;
+    uint64_t total;
+    uint64_t max;
+    uint64_t calls;
+} Func;
+
+typedef struct {
+    uint16_t addr;
+    uint8_t mask;
+} Z80Ready;
+
+// --- CPU ---
+static uint64_t clock_base;     // Cycles before the current m68k_execute slice, plus DMA stalls
+static int executing;           // Inside m68k_execute
+static int irq_level;           // Level the VDP drives
+static int irq_line;            // Level Musashi was last given
+static uint32_t fault_handler[12];  // Handler address of each fatal vector, 0 = none
+
+// --- Memory ---
+static uint8_t* rom;
+static uint32_t rom_size;
+static uint8_t ram[0x10000];
+static uint8_t z80_ram[0x2000];
+static uint8_t sram[SRAM_SIZE];
+static int sram_enabled;
+static uint8_t io_data[3], io_ctrl[3];
+static Z80Ready z80_ready[MAX_Z80_READY];
+static int z80_ready_count;
+static uint32_t unmapped_reads, unmapped_writes;
+
+// --- Video ---
+static int pal;
+static int lines_per_frame;
+static uint64_t line_total;     // Lines since reset
+static int line;                // Line in the current video frame
+static uint64_t video_frames;
+static uint64_t vblank_count;
+static uint8_t vdp_reg[32];
+static int cmd_pending;
+static uint16_t cmd_first;
+static int vint_pending, hint_pending;
+static int hint_counter;
+
+// --- KDebug ---
+static char log_line[LOG_LINE_MAX];
+static int log_len;
+static uint64_t kdebug_timer;
+static int done_seen, halt_seen;
+
+// --- Profile ---
+static Symbol* syms;
+static int sym_count;
+static int32_t* rom_sym;        // Symbol index per ROM word, -1 before the first symbol
+static Frame stack[MAX_DEPTH];
+static int depth;
+static int depth_overflow;
+static Func funcs[MAX_FUNCS];
+static int func_count;
+static int attr_sym = -1;       // Symbol charged with cycles up to the next instruction
+static int attr_pending;        // Exception entry: charge the handler's first instruction
+static int exception_pending;   // Interrupt acknowledged: the next instruction is its handler
+static int last_op;             // OP_* of the previous instruction
+static uint32_t last_pc, last_sp;
+static uint64_t attr_last;
+static uint32_t begin_addr, end_addr;
+static int in_frame, measuring;
+static uint64_t frame_start, frame_vblank;
+static uint64_t frames_run, frames_measured;
+static uint64_t frame_sum, frame_max, frame_min = UINT64_MAX;
+static uint32_t over_budget, missed_vblank;
+static uint64_t last_frame_video;
+static uint32_t* frame_cycles;
+static uint8_t* frame_missed;
+static size_t frame_cap;
+static int fatal;
+static char fatal_msg[160];
+
+// --- Options ---
+static const char* rom_path;
+static const char* sym_path;
+static const char* csv_path;
+static const char* begin_name = "stressBegin";
+static const char* end_name = "stressEnd";
+static uint64_t opt_frames, opt_skip;
+static uint64_t budget;
+static uint32_t max_overruns;
+static int top_n = 20;
+static uint64_t stall_frames = 600;
+
+static void usage(void){
+    fprintf(stderr, "usage: cyclerun <rom.bin> --sym <rom.sym> [--frame-begin SYM] [--frame-end SYM]\n"
+                    "                [--func SYM ...] [--frames N] [--skip N] [--budget CYCLES]\n"
+                    "                [--max-overruns N] [--top N] [--csv FILE] [--pal]\n"
+                    "                [--z80-ready ADDR:MASK|none] [--stall-frames N]\n");
+    exit(2);
+}
+
+// --- Symbols ---
+
+static int symAt(uint32_t pc){
+    if (pc < rom_size && rom_sym) return rom_sym[pc >> 1];
+    int lo = 0, hi = sym_count - 1, best = -1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (syms[mid].addr <= pc) { best = mid; lo = mid + 1; }
+        else hi = mid - 1;
+    }
+    return best;
+}
+
+static const char* symName(int s){
+    return s >= 0 ? syms[s].name : "?";
+}
+
+static int symFind(const char* name){
+    for (int i = 0; i < sym_count; i++) {
+        if (strcmp(syms[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static int symCompare(const void* a, const void* b){
+    const Symbol* x = a;
+    const Symbol* y = b;
+    return (x->addr > y->addr) - (x->addr < y->addr);
+}
+
+// nm output: "<hex address> <type> <name>"; code symbols only
+static void loadSymbols(const char* path){
+    FILE* f = fopen(path, "r");
+    if (!f){
+        fprintf(stderr, "cyclerun: cannot open %s\n", path);
+        exit(2);
+    }
+    char text[512];
+    int cap = 0;
+    while (fgets(text, sizeof(text), f)) {
+        unsigned long addr;
+        char type;
+        char name[400];
+        if (sscanf(text, "%lx %c %399s", &addr, &type, name) != 3) continue;
+        if (type != 'T' && type != 't' && type != 'W' && type != 'w') continue;
+        if (sym_count == cap){
+            cap = cap ? cap * 2 : 1024;
+            syms = realloc(syms, cap * sizeof(Symbol));
+        }
+        Symbol* s = &syms[sym_count++];
+        memset(s, 0, sizeof(*s));
+        s->addr = (uint32_t)addr & 0xFFFFFF;
+        s->name = strdup(name);
+    }
+    fclose(f);
+    if (sym_count == 0){
+        fprintf(stderr, "cyclerun: no code symbols in %s\n", path);
+        exit(2);
+    }
+    qsort(syms, sym_count, sizeof(Symbol), symCompare);
+
+    rom_sym = malloc((rom_size / 2) * sizeof(int32_t));
+    int s = -1;
+    for (uint32_t w = 0; w < rom_size / 2; w++) {
+        while (s + 1 < sym_count && syms[s + 1].addr <= w * 2) s++;
+        rom_sym[w] = s;
+    }
+}
+
+// --- CPU clock ---
+
+static uint64_t now(void){
+    return clock_base + (executing ? (uint64_t)m68k_cycles_run() : 0);
+}
+
+// Stop the current slice after this instruction, so the main loop sees the new state
+static void endSlice(void){
+    if (executing) m68k_modify_timeslice(-m68k_cycles_remaining());
+}
+
+static uint32_t cpuReg(m68k_register_t r){
+    return m68k_get_reg(NULL, r);
+}
+
+// --- Profile hooks ---
+
+static void charge(int s){
+    uint64_t t = now();
+    uint64_t delta = t - attr_last;
+    attr_last = t;
+    if (measuring && in_frame && s >= 0) syms[s].self += delta;
+}
+
+static void fail(const char* msg){
+    if (fatal) return;
+    fatal = 1;
+    snprintf(fatal_msg, sizeof(fatal_msg), "%s", msg);
+}
+
+static void frameBegin(void){
+    in_frame = 1;
+    measuring = frames_run >= opt_skip && !(opt_frames && frames_measured >= opt_frames);
+    frame_start = now();
+    frame_vblank = vblank_count;
+    for (int i = 0; i < func_count; i++) {
+        funcs[i].frame_incl = 0;
+        funcs[i].frame_calls = 0;
+    }
+}
+
+static void frameEnd(void){
+    uint64_t t = now() - frame_start;
+    int missed = vblank_count != frame_vblank;
+
+    in_frame = 0;
+    frames_run++;
+    last_frame_video = video_frames;
+    if (!measuring) return;
+
+    if (frames_measured == frame_cap){
+        frame_cap = frame_cap ? frame_cap * 2 : 1024;
+        frame_cycles = realloc(frame_cycles, frame_cap * sizeof(uint32_t));
+        frame_missed = realloc(frame_missed, frame_cap);
+    }
+    frame_cycles[frames_measured] = (uint32_t)t;
+    frame_missed[frames_measured] = missed;
+    frames_measured++;
+
+    frame_sum += t;
+    if (t > frame_max) frame_max = t;
+    if (t < frame_min) frame_min = t;
+    if (t > budget) over_budget++;
+    if (missed) missed_vblank++;
+
+    for (int i = 0; i < func_count; i++) {
+        Func* f = &funcs[i];
+        f->total += f->frame_incl;
+        f->calls += f->frame_calls;
+        if (f->frame_incl > f->max) f->max = f->frame_incl;
+    }
+}
+
+static void onInstr(uint32_t pc){
+    int s = symAt(pc);
+    charge(attr_pending ? s : attr_sym);
+    attr_pending = 0;
+    attr_sym = s;
+
+    if (pc == end_addr && in_frame) frameEnd();
+    if (pc == begin_addr) frameBegin();
+}
+
+// Execution reached a fatal vector's handler: the previous instruction faulted
+static void checkFault(uint32_t pc){
+    static const char* const names[] = { "", "", "bus error", "address error", "illegal instruction",
+                                         "zero divide", "CHK", "TRAPV", "privilege violation",
+                                         "trace", "line 1010", "line 1111" };
+    for (int v = 2; v < 12; v++) {
+        if (fault_handler[v] && pc == fault_handler[v]){
+            char msg[160];
+            snprintf(msg, sizeof(msg), "CPU exception: %s at $%06X (%s)", names[v], last_pc, symName(symAt(last_pc)));
+            fail(msg);
+            return;
+        }
+    }
+}
+
+static void onCall(uint32_t target, uint32_t sp, int exception){
+    if (depth == MAX_DEPTH){
+        depth_overflow = 1;
+        return;
+    }
+    Frame* f = &stack[depth++];
+    f->sym = symAt(target);
+    f->sp = sp;
+    f->entry = exception ? attr_last : now();       // attr_last is the exception's start
+    if (f->sym >= 0) syms[f->sym].active++;
+}
+
+// sp is where the return address (RTE: the status register) was
+static void onReturn(uint32_t sp){
+    while (depth > 0 && stack[depth - 1].sp <= sp) {
+        Frame* f = &stack[--depth];
+        if (f->sym < 0) continue;
+        Symbol* s = &syms[f->sym];
+        s->active--;
+        if (s->active > 0) continue;      // Recursion: counted once, by the outermost frame
+        uint64_t incl = now() - f->entry;
+        if (in_frame && measuring){
+            s->incl += incl;
+            s->calls++;
+            for (int i = 0; i < func_count; i++) {
+                if (funcs[i].sym == f->sym){
+                    funcs[i].frame_incl += incl;
+                    funcs[i].frame_calls++;
+                }
+            }
+        }
+    }
+}
+
+// --- Video ---
+
+static int vblankLine(void){
+    return (vdp_reg[1] & 0x08) ? 240 : 224;     // V30 / V28
+}
+
+// Musashi takes an interrupt as soon as it is raised, so a higher level only reaches the
+// core between slices (see main); a lower one at the next instruction hook
+static void updateIrq(void){
+    if (vint_pending && (vdp_reg[1] & 0x20)) irq_level = 6;
+    else if (hint_pending && (vdp_reg[0] & 0x10)) irq_level = 4;
+    else irq_level = 0;
+    if (irq_level > irq_line) endSlice();
+}
+
+static uint32_t linePos(void){
+    uint64_t mclk = now() * MCLK_PER_CYCLE;
+    uint64_t start = line_total * MCLK_PER_LINE;
+    if (mclk < start) return 0;
+    uint64_t pos = mclk - start;
+    return pos >= MCLK_PER_LINE ? MCLK_PER_LINE - 1 : (uint32_t)pos;
+}
+
+static int inVblank(void){
+    return line >= vblankLine() || !(vdp_reg[1] & 0x40);     // Display off reads as vblank
+}
+
+static uint16_t vdpStatus(void){
+    uint16_t s = 0x0200;                        // FIFO empty
+    if (vint_pending) s |= 0x0080;
+    if (inVblank()) s |= 0x0008;
+    if (linePos() >= HBLANK_MCLK) s |= 0x0004;
+    if (pal) s |= 0x0001;
+    return s;
+}
+
+static uint16_t hvCounter(void){
+    int v = line;
+    if (!pal && v > 0xEA) v -= 6;               // NTSC V28: 0x00-0xEA, 0xE5-0xFF
+    if (pal && v > 0x102) v -= 57;              // PAL V28: 0x00-0x102, 0x1CA-0x1FF
+    uint32_t h = linePos() * 210 / MCLK_PER_LINE;
+    if (h > 0xB6) h += 0xE4 - 0xB7;             // H40: 0x00-0xB6, 0xE4-0xFF
+    return ((v & 0xFF) << 8) | (h & 0xFF);
+}
+
+static void flushLog(void){
+    log_line[log_len] = 0;
+    printf("klog: %s\n", log_line);
+    if (strncmp(log_line, "done,", 5) == 0) done_seen = 1;
+    log_len = 0;
+}
+
+static void kdebug(int reg, uint8_t v){
+    if (reg == 30){
+        if (v == 0) flushLog();
+        else if (log_len < LOG_LINE_MAX - 1) log_line[log_len++] = v;
+    } else if (reg == 31){
+        if (v == 0xC0) kdebug_timer = now();
+        else if (v == 0x00) printf("klog: #timer %llu cycles\n", (unsigned long long)(now() - kdebug_timer));
+    } else if (reg == 29 && v == 0){
+        halt_seen = 1;
+    }
+}
+
+// 68k to VDP DMA holds the 68k off the bus for the whole transfer
+static void dmaStall(void){
+    uint32_t words = vdp_reg[19] | (vdp_reg[20] << 8);
+    if (words == 0) words = 0x10000;
+    uint32_t per_word = inVblank() ? DMA_MCLK_VBLANK : DMA_MCLK_ACTIVE;
+    clock_base += ((uint64_t)words * per_word + MCLK_PER_CYCLE - 1) / MCLK_PER_CYCLE;
+    endSlice();
+}
+
+static void vdpControl(uint16_t v){
+    if (cmd_pending){
+        cmd_pending = 0;
+        uint8_t code = ((cmd_first >> 14) & 3) | ((v >> 2) & 0x3C);
+        if ((code & 0x20) && (vdp_reg[1] & 0x10) && !(vdp_reg[23] & 0x80)) dmaStall();
+        return;
+    }
+    if ((v & 0xC000) == 0x8000){
+        int reg = (v >> 8) & 0x1F;
+        uint8_t value = v & 0xFF;
+        if (reg >= 29){
+            kdebug(reg, value);
+            return;
+        }
+        vdp_reg[reg] = value;
+        updateIrq();
+        return;
+    }
+    cmd_first = v;
+    cmd_pending = 1;
+}
+
+// --- Bus ---
+
+static uint8_t* ramPtr(uint32_t addr) { return &ram[addr & 0xFFFF]; }
+
+static uint8_t ioRead(uint32_t addr){
+    int reg = (addr & 0x1F) >> 1;
+    if (reg == 0) return pal ? 0xE0 : 0xA0;                 // Overseas, no expansion unit
+    if (reg >= 1 && reg <= 3){
+        int port = reg - 1;
+        // No buttons held: TH high reads C B R L D U = 1, TH low reads 0 0 (3-button ID) with Start A D U = 1
+        uint8_t pins = (io_data[port] & 0x40) ? 0x7F : 0x33;
+        return (io_data[port] & io_ctrl[port]) | (pins & ~io_ctrl[port] & 0x7F);
+    }
+    if (reg >= 4 && reg <= 6) return io_ctrl[reg - 4];
+    return 0;
+}
+
+static void ioWrite(uint32_t addr, uint8_t v){
+    int reg = (addr & 0x1F) >> 1;
+    if (reg >= 1 && reg <= 3) io_data[reg - 1] = v;
+    else if (reg >= 4 && reg <= 6) io_ctrl[reg - 4] = v;
+}
+
+static uint8_t z80Read(uint32_t addr){
+    if ((addr & 0xFFFF) >= 0x4000){
+        return 0;                               // YM2612 status: never busy
+    }
+    uint16_t a = addr & 0x1FFF;
+    uint8_t v = z80_ram[a];
+    for (int i = 0; i < z80_ready_count; i++) {
+        if (z80_ready[i].addr == a) v |= z80_ready[i].mask;
+    }
+    return v;
+}
+
+static uint8_t read8(uint32_t addr){
+    if (addr < rom_size) return rom[addr];
+    if (sram_enabled && addr >= SRAM_BASE && addr < SRAM_BASE + SRAM_SIZE) return sram[addr - SRAM_BASE];
+    if (addr >= 0xE00000) return *ramPtr(addr);
+    if (addr >= 0xA00000 && addr < 0xA10000) return z80Read(addr);
+    if (addr >= 0xA10000 && addr < 0xA10020) return ioRead(addr);
+    if (addr >= 0xA11100 && addr < 0xA11102) return 0;    // Z80 bus granted
+    if (addr >= 0xC00000 && addr < 0xC00020){
+        if (addr < 0xC00004) return 0;
+        if (addr < 0xC00008){
+            uint16_t s = vdpStatus();
+            cmd_pending = 0;
+            return (addr & 1) ? s : s >> 8;
+        }
+        uint16_t hv = hvCounter();
+        return (addr & 1) ? hv : hv >> 8;
+    }
+    unmapped_reads++;
+    return 0xFF;
+}
+
+static uint16_t read16(uint32_t addr){
+    if (addr < rom_size) return (rom[addr] << 8) | rom[addr + 1];
+    if (addr >= 0xE00000) return (ram[addr & 0xFFFF] << 8) | ram[(addr + 1) & 0xFFFF];
+    if (addr >= 0xC00000 && addr < 0xC00020){
+        if (addr < 0xC00004) return 0;
+        if (addr < 0xC00008){
+            cmd_pending = 0;
+            return vdpStatus();
+        }
+        return hvCounter();
+    }
+    if (addr >= 0xA00000 && addr < 0xA10000){
+        uint8_t v = z80Read(addr);              // Byte bus: both halves see it
+        return (v << 8) | v;
+    }
+    return (read8(addr) << 8) | read8(addr + 1);
+}
+
+static void write8(uint32_t addr, uint8_t v){
+    if (addr >= 0xE00000){
+        *ramPtr(addr) = v;
+        return;
+    }
+    if (sram_enabled && addr >= SRAM_BASE && addr < SRAM_BASE + SRAM_SIZE){
+        sram[addr - SRAM_BASE] = v;
+        return;
+    }
+    if (addr < rom_size) return;
+    if (addr >= 0xA00000 && addr < 0xA10000){
+        if ((addr & 0xFFFF) < 0x4000) z80_ram[addr & 0x1FFF] = v;
+        return;
+    }
+    if (addr >= 0xA10000 && addr < 0xA10020){
+        ioWrite(addr, v);
+        return;
+    }
+    if (addr == 0xA130F1){
+        sram_enabled = v & 1;
+        return;
+    }
+    if (addr >= 0xC00000 && addr < 0xC00020){
+        if (addr >= 0xC00004 && addr < 0xC00008) vdpControl((v << 8) | v);
+        return;                                 // Data port, PSG, debug register
+    }
+    if ((addr >= 0xA11000 && addr < 0xA11300) || (addr >= 0xA13000 && addr < 0xA14104)) return;
+    unmapped_writes++;
+}
+
+static void write16(uint32_t addr, uint16_t v){
+    if (addr >= 0xE00000){
+        ram[addr & 0xFFFF] = v >> 8;
+        ram[(addr + 1) & 0xFFFF] = v;
+        return;
+    }
+    if (addr >= 0xC00000 && addr < 0xC00020){
+        if (addr >= 0xC00004 && addr < 0xC00008) vdpControl(v);
+        return;
+    }
+    if (addr >= 0xA00000 && addr < 0xA10000){
+        write8(addr, v >> 8);                   // Only the high byte reaches the Z80 bus
+        return;
+    }
+    write8(addr, v >> 8);
+    write8(addr + 1, v);
+}
+
+// --- Musashi callbacks ---
+
+unsigned int m68k_read_memory_8(unsigned int addr)  { return read8(addr); }
+unsigned int m68k_read_memory_16(unsigned int addr) { return read16(addr); }
+unsigned int m68k_read_memory_32(unsigned int addr) { return (read16(addr) << 16) | read16(addr + 2); }
+void m68k_write_memory_8(unsigned int addr, unsigned int v)  { write8(addr, v); }
+void m68k_write_memory_16(unsigned int addr, unsigned int v) { write16(addr, v); }
+void m68k_write_memory_32(unsigned int addr, unsigned int v) { write16(addr, v >> 16); write16(addr + 2, v); }
+
+// Opcode fetch without side effects, for the disassembler and the call tracking below
+static uint16_t codeWord(uint32_t addr){
+    addr &= 0xFFFFFE;
+    if (addr < rom_size) return (rom[addr] << 8) | rom[addr + 1];
+    if (addr >= 0xE00000) return (ram[addr & 0xFFFF] << 8) | ram[(addr + 1) & 0xFFFF];
+    return 0;
+}
+
+unsigned int m68k_read_disassembler_8(unsigned int addr)  { return (addr & 1) ? codeWord(addr) & 0xFF : codeWord(addr) >> 8; }
+unsigned int m68k_read_disassembler_16(unsigned int addr) { return codeWord(addr); }
+unsigned int m68k_read_disassembler_32(unsigned int addr) { return (codeWord(addr) << 16) | codeWord(addr + 2); }
+
+enum { OP_OTHER, OP_CALL, OP_RETURN };
+
+static int opKind(uint32_t pc){
+    uint16_t op = codeWord(pc);
+    if ((op & 0xFF00) == 0x6100 || (op & 0xFFC0) == 0x4E80) return OP_CALL;        // BSR, JSR
+    if (op == 0x4E75 || op == 0x4E77 || op == 0x4E73) return OP_RETURN;            // RTS, RTR, RTE
+    return OP_OTHER;
+}
+
+// Finish the previous instruction's call or return, now that it has executed
+static void settle(uint32_t pc, uint32_t sp){
+    if (last_op == OP_CALL) onCall(pc, sp, 0);
+    else if (last_op == OP_RETURN) onReturn(last_sp);
+    last_op = OP_OTHER;
+}
+
+// M68K_INSTRUCTION_CALLBACK: before each instruction
+void cyclerunInstrHook(void){
+    uint32_t pc = cpuReg(M68K_REG_PC);
+    uint32_t sp = cpuReg(M68K_REG_A7);
+
+    if (irq_level < irq_line){          // Acknowledged: lowering the line never interrupts
+        irq_line = irq_level;
+        m68k_set_irq(irq_level);
+    }
+    settle(pc, sp);
+    if (exception_pending){
+        exception_pending = 0;
+        onCall(pc, sp, 1);
+    }
+    checkFault(pc);
+    onInstr(pc);
+
+    last_op = opKind(pc);
+    last_pc = pc;
+    last_sp = sp;
+}
+
+// M68K_INT_ACK_CALLBACK: before the interrupt's exception processing
+int cyclerunIntAck(int level){
+    settle(cpuReg(M68K_REG_PC), cpuReg(M68K_REG_A7));
+    charge(attr_sym);
+    attr_pending = 1;
+    exception_pending = 1;
+
+    if (level == 6) vint_pending = 0;
+    else if (level == 4) hint_pending = 0;
+    updateIrq();
+    return M68K_INT_ACK_AUTOVECTOR;
+}
+
+// --- Video timing ---
+
+static void nextLine(void){
+    line_total++;
+    line++;
+    if (line == lines_per_frame){
+        line = 0;
+        video_frames++;
+    }
+
+    int vb = vblankLine();
+    if (line == vb){
+        vint_pending = 1;
+        vblank_count++;
+    }
+    if (line <= vb){
+        if (--hint_counter < 0){
+            hint_counter = vdp_reg[10];
+            hint_pending = 1;
+        }
+    } else {
+        hint_counter = vdp_reg[10];
+    }
+    updateIrq();
+}
+
+// --- Report ---
+
+static int compareSelf(const void* a, const void* b){
+    const Symbol* x = *(const Symbol* const*)a;
+    const Symbol* y = *(const Symbol* const*)b;
+    return (y->self > x->self) - (y->self < x->self);
+}
+
+static void report(void){
+    double frames = frames_measured ? (double)frames_measured : 1.0;
+    uint64_t measured_total = 0;
+    for (int i = 0; i < sym_count; i++) measured_total += syms[i].self;
+
+    printf("cyclerun: %s, %s, budget %llu cycles/frame\n", rom_path, pal ? "PAL" : "NTSC", (unsigned long long)budget);
+    printf("frames: %llu measured, %llu skipped, %llu video frames\n",
+           (unsigned long long)frames_measured, (unsigned long long)(frames_run - frames_measured),
+           (unsigned long long)video_frames);
+    if (frames_measured){
+        printf("frame cycles: avg %.0f  min %llu  max %llu  (%.1f%% of budget at max)\n",
+               frame_sum / frames, (unsigned long long)frame_min, (unsigned long long)frame_max,
+               100.0 * frame_max / budget);
+    }
+    printf("overruns: %u over budget, %u past their vblank (allowed %u)\n", over_budget, missed_vblank, max_overruns);
+
+    if (func_count){
+        printf("\n%-28s %10s %10s %10s %8s\n", "function (inclusive)", "calls/frm", "avg", "max", "%budget");
+        for (int i = 0; i < func_count; i++) {
+            Func* f = &funcs[i];
+            printf("%-28s %10.2f %10.0f %10llu %7.1f%%\n", f->name, f->calls / frames, f->total / frames,
+                   (unsigned long long)f->max, 100.0 * f->max / budget);
+        }
+    }
+
+    Symbol** order = malloc(sym_count * sizeof(Symbol*));
+    for (int i = 0; i < sym_count; i++) order[i] = &syms[i];
+    qsort(order, sym_count, sizeof(Symbol*), compareSelf);
+    printf("\n%-28s %12s %6s %12s %10s\n", "symbol (per frame)", "self", "%", "inclusive", "calls");
+    for (int i = 0; i < top_n && i < sym_count && order[i]->self; i++) {
+        Symbol* s = order[i];
+        printf("%-28s %12.0f %5.1f%% %12.0f %10.2f\n", s->name, s->self / frames,
+               measured_total ? 100.0 * s->self / measured_total : 0.0, s->incl / frames, s->calls / frames);
+    }
+
+    if (depth_overflow) printf("\nwarning: call stack deeper than %d; some inclusive times are missing\n", MAX_DEPTH);
+    if (unmapped_reads || unmapped_writes) printf("\nnote: %u unmapped reads, %u unmapped writes\n", unmapped_reads, unmapped_writes);
+
+    if (csv_path){
+        FILE* f = fopen(csv_path, "w");
+        if (!f){
+            fprintf(stderr, "cyclerun: cannot write %s\n", csv_path);
+        } else {
+            fprintf(f, "kind,name,a,b,c\n");
+            for (uint64_t i = 0; i < frames_measured; i++) {
+                fprintf(f, "frame,%llu,%u,%u,\n", (unsigned long long)i, frame_cycles[i], frame_missed[i]);
+            }
+            for (int i = 0; i < func_count; i++) {
+                fprintf(f, "func,%s,%.2f,%.0f,%llu\n", funcs[i].name, funcs[i].calls / frames,
+                        funcs[i].total / frames, (unsigned long long)funcs[i].max);
+            }
+            for (int i = 0; i < sym_count; i++) {
+                Symbol* s = order[i];
+                if (!s->self && !s->incl) break;
+                fprintf(f, "symbol,%s,%llu,%llu,%u\n", s->name, (unsigned long long)s->self,
+                        (unsigned long long)s->incl, s->calls);
+            }
+            fclose(f);
+        }
+    }
+    free(order);
+}
+
+// --- Main ---
+
+static uint64_t parseNumber(const char* s){
+    char* end;
+    uint64_t v = strtoull(s, &end, 0);
+    if (*s == 0 || *end != 0){
+        fprintf(stderr, "cyclerun: bad number '%s'\n", s);
+        exit(2);
+    }
+    return v;
+}
+
+static void parseZ80Ready(const char* s){
+    if (strcmp(s, "none") == 0){
+        z80_ready_count = 0;
+        return;
+    }
+    unsigned a, m;
+    if (sscanf(s, "%i:%i", &a, &m) != 2 || a >= sizeof(z80_ram) || m > 0xFF || z80_ready_count == MAX_Z80_READY){
+        fprintf(stderr, "cyclerun: bad --z80-ready '%s'\n", s);
+        exit(2);
+    }
+    z80_ready[z80_ready_count].addr = a;
+    z80_ready[z80_ready_count].mask = m;
+    z80_ready_count++;
+}
+
+static void loadRom(const char* path){
+    FILE* f = fopen(path, "rb");
+    if (!f){
+        fprintf(stderr, "cyclerun: cannot open %s\n", path);
+        exit(2);
+    }
+    rom = calloc(ROM_MAX, 1);
+    rom_size = fread(rom, 1, ROM_MAX, f);
+    fclose(f);
+    rom_size = (rom_size + 1) & ~1u;
+    if (rom_size < 0x200){
+        fprintf(stderr, "cyclerun: %s is too small for a ROM\n", path);
+        exit(2);
+    }
+}
+
+int main(int argc, char** argv){
+    int z80_default = 1;
+    const char* func_names[MAX_FUNCS];
+
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (a[0] != '-'){
+            if (rom_path) usage();
+            rom_path = a;
+            continue;
+        }
+        if (strcmp(a, "--pal") == 0){
+            pal = 1;
+            continue;
+        }
+        if (!v) usage();
+        i++;
+        if (strcmp(a, "--sym") == 0) sym_path = v;
+        else if (strcmp(a, "--frame-begin") == 0) begin_name = v;
+        else if (strcmp(a, "--frame-end") == 0) end_name = v;
+        else if (strcmp(a, "--func") == 0){
+            if (func_count == MAX_FUNCS) usage();
+            func_names[func_count++] = v;
+        }
+        else if (strcmp(a, "--frames") == 0) opt_frames = parseNumber(v);
+        else if (strcmp(a, "--skip") == 0) opt_skip = parseNumber(v);
+        else if (strcmp(a, "--budget") == 0) budget = parseNumber(v);
+        else if (strcmp(a, "--max-overruns") == 0) max_overruns = parseNumber(v);
+        else if (strcmp(a, "--top") == 0) top_n = parseNumber(v);
+        else if (strcmp(a, "--csv") == 0) csv_path = v;
+        else if (strcmp(a, "--stall-frames") == 0) stall_frames = parseNumber(v);
+        else if (strcmp(a, "--z80-ready") == 0){
+            z80_default = 0;
+            parseZ80Ready(v);
+        }
+        else usage();
+    }
+    if (!rom_path || !sym_path) usage();
+    if (z80_default) parseZ80Ready("0x102:0x80");
+
+    loadRom(rom_path);
+    loadSymbols(sym_path);
+
+    int b = symFind(begin_name), e = symFind(end_name);
+    if (b < 0 || e < 0){
+        fprintf(stderr, "cyclerun: frame marker %s not in %s (is this a STRESS_SCENARIO build?)\n",
+                b < 0 ? begin_name : end_name, sym_path);
+        return 2;
+    }
+    begin_addr = syms[b].addr;
+    end_addr = syms[e].addr;
+    for (int i = 0; i < func_count; i++) {
+        funcs[i].name = func_names[i];
+        funcs[i].sym = symFind(func_names[i]);
+        if (funcs[i].sym < 0){
+            fprintf(stderr, "cyclerun: --func %s not in %s\n", func_names[i], sym_path);
+            return 2;
+        }
+    }
+
+    lines_per_frame = pal ? 313 : 262;
+    uint64_t frame_mclk = (uint64_t)MCLK_PER_LINE * lines_per_frame;
+    if (!budget) budget = frame_mclk / MCLK_PER_CYCLE;
+
+    for (int v = 2; v < 12; v++) {
+        if (v != 9) fault_handler[v] = ((rom[v * 4 + 1] << 16) | (rom[v * 4 + 2] << 8) | rom[v * 4 + 3]);
+    }
+    memset(sram, 0xFF, sizeof(sram));
+    m68k_init();
+    m68k_set_cpu_type(M68K_CPU_TYPE_68000);
+    m68k_pulse_reset();
+    attr_last = now();
+
+    while (!fatal && !done_seen && !halt_seen) {
+        if (opt_frames && frames_measured >= opt_frames) break;
+
+        // Run to the end of the line (or until something ends the slice early)
+        uint64_t line_end = ((line_total + 1) * MCLK_PER_LINE + MCLK_PER_CYCLE - 1) / MCLK_PER_CYCLE;
+        uint64_t t = now();
+        executing = 1;
+        int used = m68k_execute(line_end > t ? (int)(line_end - t) : 1);
+        executing = 0;
+        clock_base += used;
+        while (now() * MCLK_PER_CYCLE >= (line_total + 1) * MCLK_PER_LINE) nextLine();
+
+        if (irq_level != irq_line){
+            irq_line = irq_level;
+            m68k_set_irq(irq_level);    // Taken here when above the mask
+        }
+
+        if (video_frames - last_frame_video > stall_frames){
+            char msg[160];
+            snprintf(msg, sizeof(msg), "no frame completed for %llu video frames; pc $%06X in %s",
+                     (unsigned long long)stall_frames, cpuReg(M68K_REG_PC), symName(symAt(cpuReg(M68K_REG_PC))));
+            fail(msg);
+        }
+    }
+    if (log_len) flushLog();
+
+    report();
+
+    int ok = 1;
+    if (fatal){
+        printf("FAIL: %s\n", fatal_msg);
+        ok = 0;
+    }
+    if (halt_seen && !done_seen && !(opt_frames && frames_measured >= opt_frames)){
+        printf("FAIL: KDebug halt before the run finished\n");
+        ok = 0;
+    }
+    if (frames_measured == 0){
+        printf("FAIL: no frames measured\n");
+        ok = 0;
+    }
+    if (over_budget > max_overruns || missed_vblank > max_overruns){
+        printf("FAIL: %u frame(s) over budget, %u past their vblank (allowed %u)\n", over_budget, missed_vblank, max_overruns);
+        ok = 0;
+    }
+    return ok ? 0 : 1;
+}
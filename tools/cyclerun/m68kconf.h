@@ -0,0 +1,46 @@
+// m68kconf.h
+// Musashi configuration for cyclerun.  The build copies this over the core's own
+// m68kconf.h (see CMakeLists.txt), which stays in the copy as m68kconf_upstream.h and
+// supplies the defaults; only the options cyclerun depends on are set here.
+#ifndef CYCLERUN_M68KCONF_H
+#define CYCLERUN_M68KCONF_H
+
+#include "m68kconf_upstream.h"
+
+// Plain 68000, one read path for program and data
+#undef M68K_EMULATE_010
+#define M68K_EMULATE_010            OPT_OFF
+#undef M68K_EMULATE_EC020
+#define M68K_EMULATE_EC020          OPT_OFF
+#undef M68K_EMULATE_020
+#define M68K_EMULATE_020            OPT_OFF
+#undef M68K_EMULATE_030
+#define M68K_EMULATE_030            OPT_OFF
+#undef M68K_EMULATE_040
+#define M68K_EMULATE_040            OPT_OFF
+#undef M68K_SEPARATE_READS
+#define M68K_SEPARATE_READS         OPT_OFF
+#undef M68K_LOG_ENABLE
+#define M68K_LOG_ENABLE             OPT_OFF
+
+// Profiling: cyclerunInstrHook runs before every instruction (older Musashi releases
+// pass no PC to the callback, hence the variadic macro)
+#undef M68K_INSTRUCTION_HOOK
+#define M68K_INSTRUCTION_HOOK       OPT_SPECIFY_HANDLER
+#undef M68K_INSTRUCTION_CALLBACK
+#define M68K_INSTRUCTION_CALLBACK(...) cyclerunInstrHook()
+
+// VINT/HINT acknowledge clears the VDP's pending flag
+#undef M68K_EMULATE_INT_ACK
+#define M68K_EMULATE_INT_ACK        OPT_SPECIFY_HANDLER
+#undef M68K_INT_ACK_CALLBACK
+#define M68K_INT_ACK_CALLBACK(A)    cyclerunIntAck(A)
+
+// Odd word and long accesses run the address error handler, which cyclerun reports
+#undef M68K_EMULATE_ADDRESS_ERROR
+#define M68K_EMULATE_ADDRESS_ERROR  OPT_ON
+
+void cyclerunInstrHook(void);
+int cyclerunIntAck(int level);
+
+#endif // CYCLERUN_M68KCONF_H
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# gen_hitboxes.py
+#
+# Build step: read the SPRITE entries of resources.res, slice each sprite sheet into
+# frames the way rescomp does (rows are animations, columns are frames), and emit
+# per-frame tight hitboxes plus 1-bit row masks as const tables.
+#
+#   gen_hitboxes.py [--check] res/resources.res <out_dir>
+#
+# Writes <out_dir>/hitbox_table.h and <out_dir>/hitbox_table.c.  The tables are committed
+# in res/ so the plain SGDK makefile.gen build compiles them too; rerun
+#   tools/gen_hitboxes.py res/resources.res res
+# after changing a sprite sheet.  With --check nothing is written and the exit status
+# is 1 when the files in <out_dir> are stale (the CMake build runs this).  A table is named after
+# its resource with _res swapped for _hit (fighter_sprite_res -> fighter_sprite_hit).
+# The header also defines <TABLE>_MIN/_MAX, the box bounds over all frames of a table.
+# Pixels with palette index 0 (or alpha 0) are transparent, as in SGDK.
+# Masks are only emitted for sprites up to MASK_MAX_WIDTH pixels wide.
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+MASK_MAX_WIDTH = 16
+
+SPRITE_RE = re.compile(r'^\s*SPRITE\s+(\w+)\s+"([^"]+)"\s+(\d+)\s+(\d+)')
+
+
+def read_png(path):
+    """Return (width, height, pixels) where pixels[y][x] is True for opaque pixels."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG file' % path)
+
+    pos = 8
+    idat = b''
+    width = height = depth = ctype = interlace = None
+    trns = None
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'tRNS':
+            trns = body
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    if interlace:
+        raise ValueError('%s: interlaced PNGs are not supported' % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bpp = max(1, channels * depth // 8)  # Bytes per pixel for filtering
+    stride = (width * channels * depth + 7) // 8
+
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pr = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+                line[i] = (line[i] + pr) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def sample(line, x, ch):
+        # Sample channel ch of pixel x (depth <= 8 only, which is all rescomp accepts)
+        bit = (x * channels + ch) * depth
+        return (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+
+    pixels = []
+    for line in rows:
+        out = []
+        for x in range(width):
+            if ctype == 3:
+                out.append(sample(line, x, 0) != 0)
+            elif ctype in (4, 6):
+                out.append(sample(line, x, channels - 1) != 0)
+            else:
+                out.append(any(sample(line, x, ch) for ch in range(channels)))
+        pixels.append(out)
+    return width, height, pixels
+
+
+def frame_hitbox(pixels, fx, fy, fw, fh):
+    """Tight box (x, y, w, h) of the opaque pixels of one frame, plus its row masks."""
+    xs, ys, masks = [], [], []
+    for y in range(fh):
+        mask = 0
+        for x in range(fw):
+            if pixels[fy + y][fx + x]:
+                xs.append(x)
+                ys.append(y)
+                mask |= 0x8000 >> x
+        masks.append(mask)
+    if not xs:
+        return (0, 0, 0, 0), masks  # Empty frame never hits
+    return (min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1), masks
+
+
+def main(argv):
+    check = '--check' in argv
+    argv = [a for a in argv if a != '--check']
+    if len(argv) != 3:
+        sys.stderr.write('usage: gen_hitboxes.py [--check] <resources.res> <out_dir>\n')
+        return 1
+
+    res_file, out_dir = argv[1], argv[2]
+    res_dir = os.path.dirname(os.path.abspath(res_file))
+
+    sprites = []
+    with open(res_file) as f:
+        for line in f:
+            m = SPRITE_RE.match(line)
+            if m:
+                sprites.append((m.group(1), m.group(2), int(m.group(3)) * 8, int(m.group(4)) * 8))
+
+    h_lines = [
+        '// hitbox_table.h - generated by tools/gen_hitboxes.py from resources.res, do not edit',
+        '#ifndef HITBOX_TABLE_H',
+        '#define HITBOX_TABLE_H',
+        '',
+        '// Struct SpriteHitboxes is defined in hitbox.h',
+        '',
+    ]
+    c_lines = [
+        '// hitbox_table.c - generated by tools/gen_hitboxes.py from resources.res, do not edit',
+        '#include <genesis.h>',
+        '#include "hitbox.h"',
+        '',
+    ]
+
+    for name, png, fw, fh in sprites:
+        width, height, pixels = read_png(os.path.join(res_dir, png))
+        frames = [(x, y) for y in range(0, height - fh + 1, fh) for x in range(0, width - fw + 1, fw)]
+        hit = re.sub(r'_res$', '', name) + '_hit'
+
+        boxes, all_masks = [], []
+        for fx, fy in frames:
+            box, masks = frame_hitbox(pixels, fx, fy, fw, fh)
+            boxes.append(box)
+            all_masks.extend(masks)
+
+        c_lines.append('// %s "%s": %d frame(s) of %dx%d' % (name, png, len(frames), fw, fh))
+        c_lines.append('static const Hitbox %s_boxes[%d] = {' % (hit, len(boxes)))
+        for box in boxes:
+            c_lines.append('    { %d, %d, %d, %d },' % box)
+        c_lines.append('};')
+
+        if fw <= MASK_MAX_WIDTH:
+            c_lines.append('static const u16 %s_masks[%d] = {' % (hit, len(all_masks)))
+            for i in range(0, len(all_masks), fh):
+                c_lines.append('    ' + ', '.join('0x%04X' % m for m in all_masks[i:i + fh]) + ',')
+            c_lines.append('};')
+            c_lines.append('const SpriteHitboxes %s = { %s_boxes, %s_masks, %d, %d };'
+                           % (hit, hit, hit, len(frames), fh))
+        else:
+            c_lines.append('const SpriteHitboxes %s = { %s_boxes, NULL, %d, 0 };' % (hit, hit, len(frames)))
+        c_lines.append('')
+
+        # Bounds over every frame, for code that has to size a search around a sprite
+        solid = [box for box in boxes if box[2]]
+        lo = min([min(x, y) for x, y, w, h in solid] or [0])
+        hi = max([max(x + w, y + h) for x, y, w, h in solid] or [0])
+        h_lines.append('extern const SpriteHitboxes %s;' % hit)
+        h_lines.append('#define %s_MIN %d  // Smallest box x/y over all frames' % (hit.upper(), lo))
+        h_lines.append('#define %s_MAX %d  // Largest box x + w / y + h over all frames' % (hit.upper(), hi))
+
+    h_lines += ['', '#endif // HITBOX_TABLE_H', '']
+
+    if not check:
+        os.makedirs(out_dir, exist_ok=True)
+    stale = 0
+    for fname, lines in (('hitbox_table.h', h_lines), ('hitbox_table.c', c_lines)):
+        path = os.path.join(out_dir, fname)
+        text = '\n'.join(lines)
+        # Leave the files alone when nothing changed, so dependants are not rebuilt
+        if os.path.exists(path):
+            with open(path) as f:
+                if f.read() == text:
+                    continue
+        if check:
+            sys.stderr.write('%s is out of date; run tools/gen_hitboxes.py %s %s\n' % (path, res_file, out_dir))
+            stale += 1
+            continue
+        with open(path, 'w') as f:
+            f.write(text)
+    return 1 if stale else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+# mem_report.py
+#
+# Build step: RAM and ROM breakdown from the linker map and symbol file.
+#
+#   mem_report.py <out.map> <out.sym> <resources.res>
+#                 [--ram-budget BYTES] [--rom-budget BYTES] [--stack-reserve BYTES]
+#
+# RAM is counted per module (.data and .bss input sections of each object; SGDK's own
+# objects are grouped by archive).  ROM is counted per module (.text, .rodata, .data
+# initialisers) and per resource in resources.res, sizing each resource by the symbols
+# rescomp emitted under its name.  Exits 1 when a budget is exceeded.
+
+import argparse
+import os
+import re
+import sys
+
+RAM_BASE = 0xFF0000     # 68000 address space is 24 bit; SGDK links RAM at 0xE0FF0000
+RAM_SIZE = 0x10000
+
+SECTION_RE = re.compile(r'^ (\.\S+|COMMON)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$')
+CONT_RE = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+RES_RE = re.compile(r'^\s*[A-Z0-9_]+\s+(\w+)\s')
+SYM_RE = re.compile(r'^([0-9a-fA-F]+)\s+(\w)\s+(\S+)$')
+
+
+def module_name(path):
+    m = re.match(r'(.*?)\((.*)\)$', path)
+    if m:  # Archive member: libmd.a(sprite_eng.o) -> sgdk:libmd
+        return 'sgdk:' + os.path.splitext(os.path.basename(m.group(1)))[0]
+    name = os.path.basename(path)
+    for ext in ('.c.o', '.s.o', '.o'):
+        if name.endswith(ext):
+            return name[:-len(ext)]
+    return name
+
+
+def parse_map(path):
+    """Return {module: {'ram': bytes, 'rom': bytes}} for the linked input sections."""
+    modules = {}
+    started = False
+    pending = None
+    with open(path, errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if not started:
+                started = line.startswith('Linker script and memory map')
+                continue
+            if pending is not None:
+                m = CONT_RE.match(line)
+                sect, pending = pending, None
+                if m:
+                    add_section(modules, sect, int(m.group(1), 16), int(m.group(2), 16), m.group(3))
+                    continue
+            m = SECTION_RE.match(line)
+            if not m:
+                continue
+            if m.group(2) is None:
+                pending = m.group(1)  # Long section name, address and size on the next line
+            else:
+                add_section(modules, m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4))
+    return modules
+
+
+def add_section(modules, sect, addr, size, obj):
+    if size == 0 or obj.startswith('*'):
+        return
+    entry = modules.setdefault(module_name(obj.strip()), {'ram': 0, 'rom': 0})
+    in_ram = (addr & 0xFFFFFF) >= RAM_BASE
+    if sect.startswith('.bss') or sect == 'COMMON':
+        entry['ram'] += size
+    elif sect.startswith('.data'):
+        entry['ram'] += size
+        entry['rom'] += size  # Initialiser copied from ROM at boot
+    elif not in_ram:
+        entry['rom'] += size
+
+
+def parse_resources(path):
+    names = []
+    with open(path, errors='replace') as f:
+        for line in f:
+            if line.lstrip().startswith('//'):
+                continue
+            m = RES_RE.match(line)
+            if m:
+                names.append(m.group(1))
+    return names
+
+
+def resource_sizes(sym_path, names):
+    """Size each ROM symbol by the gap to the next one, then sum by resource name prefix."""
+    syms = []
+    with open(sym_path, errors='replace') as f:
+        for line in f:
+            m = SYM_RE.match(line.strip())
+            if m:
+                addr = int(m.group(1), 16) & 0xFFFFFF
+                if addr < RAM_BASE:
+                    syms.append((addr, m.group(3)))
+    syms.sort()
+    by_len = sorted(names, key=len, reverse=True)
+    sizes = dict((n, 0) for n in names)
+    for (addr, name), (next_addr, _) in zip(syms, syms[1:]):
+        for res in by_len:
+            if name == res or name.startswith(res + '_'):
+                sizes[res] += next_addr - addr
+                break
+    return sizes
+
+
+def main():
+    ap = argparse.ArgumentParser(description='RAM/ROM budget report')
+    ap.add_argument('map')
+    ap.add_argument('sym')
+    ap.add_argument('res')
+    ap.add_argument('--ram-budget', type=int, default=0, help='Max .data + .bss bytes (0 = no limit)')
+    ap.add_argument('--rom-budget', type=int, default=0, help='Max ROM bytes (0 = no limit)')
+    ap.add_argument('--stack-reserve', type=int, default=0, help='RAM that must stay free for heap and stack')
+    args = ap.parse_args()
+
+    modules = parse_map(args.map)
+    resources = resource_sizes(args.sym, parse_resources(args.res))
+
+    ram_total = sum(m['ram'] for m in modules.values())
+    rom_total = sum(m['rom'] for m in modules.values())
+
+    print('RAM by module (.data + .bss)')
+    for name, m in sorted(modules.items(), key=lambda kv: -kv[1]['ram']):
+        if m['ram']:
+            print('  %-24s %7d' % (name, m['ram']))
+    print('  %-24s %7d of %d, %d free' % ('total', ram_total, RAM_SIZE, RAM_SIZE - ram_total))
+
+    print('ROM by module')
+    for name, m in sorted(modules.items(), key=lambda kv: -kv[1]['rom']):
+        if m['rom']:
+            print('  %-24s %7d' % (name, m['rom']))
+    print('  %-24s %7d' % ('total', rom_total))
+
+    print('ROM by resource')
+    for name, size in sorted(resources.items(), key=lambda kv: -kv[1]):
+        print('  %-24s %7d' % (name, size))
+
+    failed = False
+    if args.ram_budget and ram_total > args.ram_budget:
+        print('RAM budget exceeded: %d > %d' % (ram_total, args.ram_budget))
+        failed = True
+    if args.stack_reserve and RAM_SIZE - ram_total < args.stack_reserve:
+        print('Stack reserve not met: %d free < %d' % (RAM_SIZE - ram_total, args.stack_reserve))
+        failed = True
+    if args.rom_budget and rom_total > args.rom_budget:
+        print('ROM budget exceeded: %d > %d' % (rom_total, args.rom_budget))
+        failed = True
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
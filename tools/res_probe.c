@@ -0,0 +1,48 @@
+// res_probe.c
+// Unpack probe ROM for tools/res_profile.py: one asset from a rescomp build, unpacked once
+// per frame between probeBegin and probeEnd, the way the game does when it loads it.  The
+// script writes probe_asset.h (PROBE_ASSET and one of PROBE_IMAGE / PROBE_TILESET /
+// PROBE_SPRITE), links the ROM with the asset's .s and runs it on tools/cyclerun, which
+// reports lz4w_unpack and aplib_unpack inclusive cycles per frame.
+#include <genesis.h>
+#include "probe_asset.h"
+
+#if defined(PROBE_IMAGE)
+extern const Image PROBE_ASSET;
+#elif defined(PROBE_TILESET)
+extern const TileSet PROBE_ASSET;
+#elif defined(PROBE_SPRITE)
+extern const SpriteDefinition PROBE_ASSET;
+#else
+#error "probe_asset.h sets no asset type"
+#endif
+
+// Frame markers for cyclerun (--frame-begin / --frame-end); kept out of line so they
+// exist as symbols
+__attribute__((noinline)) void probeBegin(void){ __asm__ volatile(""); }
+__attribute__((noinline)) void probeEnd(void){ __asm__ volatile(""); }
+
+static void unpackAsset(void){
+#if defined(PROBE_IMAGE)
+    MEM_free(unpackImage(&PROBE_ASSET, NULL));
+#elif defined(PROBE_TILESET)
+    MEM_free(unpackTileSet(&PROBE_ASSET, NULL));
+#else
+    // Every frame's tiles, as the sprite engine unpacks them on frame changes
+    for (u16 a = 0; a < PROBE_ASSET.numAnimation; a++) {
+        const Animation* anim = PROBE_ASSET.animations[a];
+        for (u16 f = 0; f < anim->numFrame; f++) {
+            MEM_free(unpackTileSet(anim->frames[f]->tileset, NULL));
+        }
+    }
+#endif
+}
+
+int main(){
+    while (TRUE) {
+        probeBegin();
+        unpackAsset();
+        probeEnd();
+    }
+    return 0;
+}
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+# res_profile.py
+#
+# Tool: build every IMAGE/TILESET/SPRITE of resources.res under each rescomp compression
+# mode, measure ROM bytes and unpack cycles, and recommend a mode per asset so the total
+# stays under a ROM cap with the least unpack time.
+#
+#   res_profile.py res/resources.res <work_dir> --rescomp "java -jar $GDK/bin/rescomp.jar"
+#                  --cyclerun <cyclerun> --cc m68k-elf-gcc --objcopy m68k-elf-objcopy
+#                  --nm m68k-elf-nm --boot src/boot/sega.s --probe tools/res_probe.c
+#                  --cflags "..." --ldflags "..." [--rom-cap BYTES]
+#
+# ROM bytes are counted from the dc.b/dc.w/dc.l data rescomp writes for the asset alone.
+# Unpack cycles are measured: each asset/mode build is linked into a probe ROM
+# (tools/res_probe.c, which unpacks the asset once per frame) and run on tools/cyclerun
+# with --func lz4w_unpack --func aplib_unpack; the cost is the inclusive cycles per frame
+# from its CSV.  NONE calls neither codec (the data goes to VRAM straight from ROM), so it
+# measures 0.
+
+import argparse
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+MODES = ['NONE', 'LZ4W', 'APLIB']   # Fastest to smallest (FAST = LZ4W, BEST = APLIB)
+ALIASES = {'FAST': 'LZ4W', 'BEST': 'APLIB'}
+
+COMPRESSION_FIELD = {'IMAGE': 3, 'TILESET': 3, 'SPRITE': 5}   # Token index of the mode
+DATA_RE = re.compile(r'^\s*dc\.([bwl])\s+(.*)$', re.IGNORECASE)
+DATA_BYTES = {'b': 1, 'w': 2, 'l': 4}
+
+
+def read_assets(res_path):
+    res_dir = os.path.dirname(os.path.abspath(res_path))
+    assets = []
+    with open(res_path, errors='replace') as f:
+        for line in f:
+            code = line.split('//')[0].strip()
+            tokens = code.split()
+            if len(tokens) < 3 or tokens[0] not in COMPRESSION_FIELD:
+                continue
+            field = COMPRESSION_FIELD[tokens[0]]
+            if len(tokens) <= field:
+                tokens += ['NONE'] * (field + 1 - len(tokens))
+            tokens[2] = '"%s"' % os.path.join(res_dir, tokens[2].strip('"'))
+            current = tokens[field].upper()
+            assets.append({'name': tokens[1], 'type': tokens[0], 'tokens': tokens, 'field': field,
+                           'current': ALIASES.get(current, current)})
+    return assets
+
+
+def asm_bytes(path):
+    total = 0
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = DATA_RE.match(line)
+            if m:
+                items = [x for x in m.group(2).split(';')[0].split(',') if x.strip()]
+                total += DATA_BYTES[m.group(1).lower()] * len(items)
+    return total
+
+
+CODEC_FUNCS = ['lz4w_unpack', 'aplib_unpack']
+PROBE_FRAMES = 2
+PROBE_TYPE = {'IMAGE': 'PROBE_IMAGE', 'TILESET': 'PROBE_TILESET', 'SPRITE': 'PROBE_SPRITE'}
+
+
+def run(cmd, what, cwd=None):
+    result = subprocess.run(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    if result.returncode != 0:
+        raise RuntimeError('%s failed:\n%s\n%s' % (what, ' '.join(cmd), result.stdout))
+    return result
+
+
+def build_asset(asset, mode, work_dir, rescomp):
+    """rescomp the asset alone under mode; returns the build directory."""
+    tokens = list(asset['tokens'])
+    tokens[asset['field']] = mode
+    build = os.path.join(work_dir, '%s_%s' % (asset['name'], mode.lower()))
+    os.makedirs(build, exist_ok=True)
+    with open(os.path.join(build, 'asset.res'), 'w') as f:
+        f.write(' '.join(tokens) + '\n')
+    run(rescomp + ['asset.res', 'asset.s'], 'rescomp on %s %s' % (asset['name'], mode), cwd=build)
+    if not os.path.exists(os.path.join(build, 'asset.s')):
+        raise RuntimeError('rescomp wrote no asset.s for %s %s' % (asset['name'], mode))
+    return build
+
+
+def codec_cycles(csv_path):
+    """Inclusive codec cycles per frame from the cyclerun CSV (func,name,calls/frame,avg,max)."""
+    total = 0.0
+    with open(csv_path) as f:
+        for line in f:
+            row = line.strip().split(',')
+            if row[0] == 'func' and len(row) >= 4 and row[1] in CODEC_FUNCS:
+                total += float(row[3])
+    return int(round(total))
+
+
+def measure_cycles(asset, build, tools):
+    """Link the probe ROM for one build, run it on cyclerun and return the unpack cycles."""
+    with open(os.path.join(build, 'probe_asset.h'), 'w') as f:
+        f.write('// Generated by res_profile.py\n')
+        f.write('#define PROBE_ASSET %s\n#define %s\n' % (asset['name'], PROBE_TYPE[asset['type']]))
+    elf = os.path.join(build, 'probe.elf')
+    rom = os.path.join(build, 'probe.bin')
+    sym = os.path.join(build, 'probe.sym')
+    csv = os.path.join(build, 'probe.csv')
+
+    run([tools.cc] + tools.cflags + ['-I', build, '-o', elf, tools.boot, tools.probe,
+         os.path.join(build, 'asset.s')] + tools.ldflags, 'probe link for %s' % asset['name'])
+    run([tools.objcopy, '-O', 'binary', elf, rom], 'objcopy')
+    with open(sym, 'w') as f:
+        f.write(run([tools.nm, '--numeric-sort', elf], 'nm').stdout)
+
+    # Large unpacks run over a video frame; only the cycle counts matter here
+    cmd = [tools.cyclerun, rom, '--sym', sym, '--frame-begin', 'probeBegin', '--frame-end', 'probeEnd',
+           '--frames', str(PROBE_FRAMES), '--max-overruns', str(PROBE_FRAMES), '--csv', csv]
+    for func in CODEC_FUNCS:
+        cmd += ['--func', func]
+    run(cmd, 'cyclerun on the %s probe' % asset['name'])
+    return codec_cycles(csv)
+
+
+def recommend(assets, cap):
+    """Start every asset on the fastest codec, then take the cheapest bytes until under cap."""
+    choice = dict((a['name'], 0) for a in assets)
+
+    def total():
+        return sum(a['size'][MODES[choice[a['name']]]] for a in assets)
+
+    while cap and total() > cap:
+        best = None
+        for a in assets:
+            i = choice[a['name']]
+            if i + 1 >= len(MODES):
+                continue
+            saved = a['size'][MODES[i]] - a['size'][MODES[i + 1]]
+            cost = a['cycles'][MODES[i + 1]] - a['cycles'][MODES[i]]
+            if saved <= 0:
+                continue
+            ratio = cost / float(saved)
+            if best is None or ratio < best[0]:
+                best = (ratio, a['name'])
+        if best is None:
+            break  # Everything is already at its smallest
+        choice[best[1]] += 1
+    return dict((name, MODES[i]) for name, i in choice.items()), total()
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Per-asset compression profile')
+    ap.add_argument('res')
+    ap.add_argument('work_dir')
+    ap.add_argument('--rescomp', required=True, help='Command that runs rescomp')
+    ap.add_argument('--rom-cap', type=int, default=0, help='Total bytes for these assets (0 = fastest)')
+    ap.add_argument('--cyclerun', required=True, help='Host build of tools/cyclerun')
+    ap.add_argument('--cc', required=True, help='m68k C compiler that links the probe ROMs')
+    ap.add_argument('--objcopy', required=True)
+    ap.add_argument('--nm', required=True)
+    ap.add_argument('--boot', required=True, help='SGDK boot source (src/boot/sega.s)')
+    ap.add_argument('--probe', required=True, help='Probe main (tools/res_probe.c)')
+    ap.add_argument('--cflags', default='', help='Compile flags for the probe ROMs')
+    ap.add_argument('--ldflags', default='', help='Link flags and libraries for the probe ROMs')
+    args = ap.parse_args()
+
+    os.makedirs(args.work_dir, exist_ok=True)
+    rescomp = shlex.split(args.rescomp)
+    args.cflags = shlex.split(args.cflags)
+    args.ldflags = shlex.split(args.ldflags)
+    for path in ('boot', 'probe'):
+        setattr(args, path, os.path.abspath(getattr(args, path)))
+    assets = read_assets(args.res)
+
+    print('Unpack cycles measured on %s (%s inclusive, per load)' % (args.cyclerun, ' + '.join(CODEC_FUNCS)))
+    print('%-22s %-6s %8s %10s' % ('asset', 'mode', 'bytes', 'cycles'))
+    for a in assets:
+        a['size'] = {}
+        a['cycles'] = {}
+        for m in MODES:
+            build = build_asset(a, m, args.work_dir, rescomp)
+            a['size'][m] = asm_bytes(os.path.join(build, 'asset.s'))
+            a['cycles'][m] = measure_cycles(a, build, args)
+            mark = '*' if m == a['current'] else ''
+            print('%-22s %-6s %8d %10d %s' % (a['name'], m, a['size'][m], a['cycles'][m], mark))
+
+    choice, total = recommend(assets, args.rom_cap)
+    current = sum(a['size'].get(a['current'], a['size']['NONE']) for a in assets)
+    print('\nRecommended (cap %s): %d bytes, current settings (*) %d bytes'
+          % (args.rom_cap or 'none', total, current))
+    for a in assets:
+        mode = choice[a['name']]
+        note = '' if mode == a['current'] else '   (was %s)' % a['current']
+        print('  %-22s %-6s %10d cycles%s' % (a['name'], mode, a['cycles'][mode], note))
+
+    if args.rom_cap and total > args.rom_cap:
+        print('ROM cap %d cannot be met' % args.rom_cap)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())